@@ -1,115 +1,93 @@
-﻿using System.Text;
+﻿using System.Security.Cryptography;
+using System.Text;
 using System.Text.Json;
+using Microsoft.CodeAnalysis;
 using Microsoft.CodeAnalysis.CSharp;
 using Microsoft.CodeAnalysis.CSharp.Syntax;
+using Microsoft.CodeAnalysis.Text;
 
 namespace CodeAnalysis
 {
+    /*
+     * Stays resident for the whole editor session and takes one request per line from standard input:
+     *     Directory <tab> Path <tab> ... : analyses every file of the directories and forgets missing ones
+     *     File <tab> Path <tab> ...      : analyses only the given files
+     *     Exit
+     * Every request is answered with Succeeded or Failed on standard output, diagnostics go to CodeAnalysis.log
+     * in the output directory so that they can not be read as a response.
+     */
     internal class CodeAnalysis
     {
         static void Main(string[] args)
         {
-            var Analysis = new CodeAnalysis(args);
+            var Analysis = new CodeAnalysis(args[0]);
 
-            Analysis.Analysis();
+            Analysis.Run();
         }
 
-        private CodeAnalysis(string[] args)
+        private CodeAnalysis(string inOutputPathName)
         {
-            _bIsSingle = bool.Parse(args[0]);
+            _outputPathName = inOutputPathName;
+        }
 
-            if (_bIsSingle)
-            {
-                _outputPathName = args[1];
+        private void Run()
+        {
+            using var Reader = new StreamReader(Console.OpenStandardInput(), new UTF8Encoding(false));
 
-                _inputFileName = args[2];
+            Directory.CreateDirectory(_outputPathName);
 
-                _inputPathNames = new List<string>();
+            using var Log = new StreamWriter(Path.Combine(_outputPathName, "CodeAnalysis.log"), false,
+                new UTF8Encoding(false));
 
-                if (File.Exists(Path.Combine(_outputPathName, DynamicFileName)))
-                {
-                    _dynamic = JsonSerializer.Deserialize<Dictionary<string, List<string>>>(
-                        File.ReadAllText(Path.Combine(_outputPathName, DynamicFileName)));
-                }
-                else
-                {
-                    _dynamic = new Dictionary<string, List<string>>
-                    {
-                        ["DynamicClass"] = new List<string>(),
-                        ["DynamicStruct"] = new List<string>(),
-                        ["DynamicEnum"] = new List<string>(),
-                        ["DynamicInterface"] = new List<string>()
-                    };
-                }
+            Log.AutoFlush = true;
 
-                if (File.Exists(Path.Combine(_outputPathName, DynamicFileFileName)))
-                {
-                    _dynamicFile = JsonSerializer.Deserialize<Dictionary<string, string>>(
-                        File.ReadAllText(Path.Combine(_outputPathName, DynamicFileFileName)));
-                }
-                else
-                {
-                    _dynamicFile = new Dictionary<string, string>();
-                }
+            // The host reads standard error from the same pipe as standard output
+            var Response = Console.Out;
 
-                if (File.Exists(Path.Combine(_outputPathName, OverrideFunctionFileName)))
-                {
-                    _overrideFunction = JsonSerializer.Deserialize<Dictionary<string, List<string>>>(
-                        File.ReadAllText(Path.Combine(_outputPathName, OverrideFunctionFileName)));
-                }
-                else
-                {
-                    _overrideFunction = new Dictionary<string, List<string>>();
-                }
+            Console.SetOut(Log);
+
+            Console.SetError(Log);
+
+            while (Reader.ReadLine() is { } Line)
+            {
+                var Arguments = Line.Split('\t', StringSplitOptions.RemoveEmptyEntries);
 
-                if (File.Exists(Path.Combine(_outputPathName, OverrideFileFileName)))
+                if (Arguments.Length == 0)
                 {
-                    _overrideFile = JsonSerializer.Deserialize<Dictionary<string, string>>(
-                        File.ReadAllText(Path.Combine(_outputPathName, OverrideFileFileName)));
+                    continue;
                 }
-                else
+
+                if (Arguments[0].Equals("Exit"))
                 {
-                    _overrideFile = new Dictionary<string, string>();
+                    break;
                 }
 
-                if (_overrideFunction != null && _overrideFile != null)
+                try
                 {
-                    var Pair = _overrideFile.FirstOrDefault(pair => pair.Value == _inputFileName);
-
-                    if (Pair.Key != null)
+                    if (Arguments[0].Equals("Directory"))
                     {
-                        _overrideFunction.Remove(Pair.Key);
-
-                        _overrideFile.Remove(Pair.Key);
+                        AnalysisDirectory(Arguments.Skip(1));
+                    }
+                    else if (Arguments[0].Equals("File"))
+                    {
+                        foreach (var Item in Arguments.Skip(1))
+                        {
+                            AnalysisFile(Path.GetFullPath(Item));
+                        }
                     }
-                }
-            }
-            else
-            {
-                _outputPathName = args[1];
-
-                _inputFileName = "";
 
-                _inputPathNames = new List<string>();
+                    WriteAll();
 
-                for (var i = 2; i < args.Length; i++)
-                {
-                    _inputPathNames.Add(args[i]);
+                    Response.WriteLine("Succeeded");
                 }
-
-                _dynamic = new Dictionary<string, List<string>>
+                catch (Exception Exception)
                 {
-                    ["DynamicClass"] = new List<string>(),
-                    ["DynamicStruct"] = new List<string>(),
-                    ["DynamicEnum"] = new List<string>(),
-                    ["DynamicInterface"] = new List<string>()
-                };
+                    Log.WriteLine(Exception);
 
-                _dynamicFile = new Dictionary<string, string>();
-
-                _overrideFunction = new Dictionary<string, List<string>>();
+                    Response.WriteLine("Failed");
+                }
 
-                _overrideFile = new Dictionary<string, string>();
+                Response.Flush();
             }
         }
 
@@ -119,6 +97,11 @@ namespace CodeAnalysis
 
             var DirectoryInfo = new DirectoryInfo(inPathName);
 
+            if (!DirectoryInfo.Exists)
+            {
+                return Files;
+            }
+
             foreach (var Item in DirectoryInfo.GetFiles("*.cs"))
             {
                 Files.Add(Item.FullName);
@@ -138,50 +121,65 @@ namespace CodeAnalysis
             return Files;
         }
 
-        private void Analysis()
+        private void AnalysisDirectory(IEnumerable<string> inPathNames)
         {
-            if (!Directory.Exists(_outputPathName))
+            var Files = new HashSet<string>();
+
+            foreach (var PathName in inPathNames)
             {
-                Directory.CreateDirectory(_outputPathName);
+                Files.UnionWith(GetFiles(PathName));
             }
 
-            foreach (var Item in Directory.GetFiles(_outputPathName))
+            foreach (var Item in _files.Keys.Where(Item => !Files.Contains(Item)).ToList())
             {
-                File.Delete(Item);
+                _files.Remove(Item);
             }
 
-            if (_bIsSingle)
+            foreach (var Item in Files)
             {
-                AnalysisSingle(_inputFileName);
+                AnalysisFile(Item);
             }
-            else
+        }
+
+        private void AnalysisFile(string inFile)
+        {
+            if (!File.Exists(inFile))
             {
-                foreach (var PathName in _inputPathNames)
-                {
-                    var Files = GetFiles(PathName);
+                _files.Remove(inFile);
 
-                    foreach (var Item in Files)
-                    {
-                        AnalysisSingle(Item);
-                    }
-                }
+                return;
             }
 
-            WriteAll();
-        }
+            var Bytes = File.ReadAllBytes(inFile);
 
-        private void AnalysisSingle(string inFile)
-        {
-            var Tree = CSharpSyntaxTree.ParseText(File.ReadAllText(inFile, Encoding.UTF8));
+            var Hash = Convert.ToHexString(SHA256.HashData(Bytes));
+
+            _files.TryGetValue(inFile, out var Result);
+
+            if (Result != null && Result.Hash == Hash)
+            {
+                return;
+            }
+
+            var Text = SourceText.From(Bytes, Bytes.Length, Encoding.UTF8);
+
+            // Reparsing against the previous tree reuses every node outside the edited spans
+            var Tree = Result != null
+                ? Result.Tree.WithChangedText(Text)
+                : CSharpSyntaxTree.ParseText(Text);
 
             var Root = (CompilationUnitSyntax)Tree.GetRoot();
 
-            AnalysisOverride(inFile, Root);
+            Result = new AnalysisResult(Hash, Tree);
+
+            AnalysisOverride(Result, Root);
+
+            AnalysisDynamic(Result, Root);
 
-            AnalysisDynamic(inFile, Root);
+            _files[inFile] = Result;
         }
 
-        private void AnalysisOverride(string inFile, CompilationUnitSyntax inRoot)
+        private static void AnalysisOverride(AnalysisResult inResult, CompilationUnitSyntax inRoot)
         {
             foreach (var RootMember in inRoot.Members)
             {
@@ -210,11 +208,8 @@ namespace CodeAnalysis
 
                             if (IsOverride)
                             {
-                                if (_overrideFile != null)
-                                {
-                                    _overrideFile[$"{NamespaceDeclaration.Name}.{ClassDeclaration.Identifier}"] =
-                                        inFile;
-                                }
+                                inResult.OverrideClasses.Add(
+                                    $"{NamespaceDeclaration.Name}.{ClassDeclaration.Identifier}");
 
                                 foreach (var MemberDeclaration in ClassDeclaration.Members)
                                 {
@@ -245,11 +240,8 @@ namespace CodeAnalysis
 
                             if (Functions.Count > 0)
                             {
-                                if (_overrideFunction != null)
-                                {
-                                    _overrideFunction[$"{NamespaceDeclaration.Name}.{ClassDeclaration.Identifier}"] =
-                                        Functions;
-                                }
+                                inResult.OverrideFunction[
+                                    $"{NamespaceDeclaration.Name}.{ClassDeclaration.Identifier}"] = Functions;
                             }
                         }
                     }
@@ -257,7 +249,7 @@ namespace CodeAnalysis
             }
         }
 
-        private void AnalysisDynamic(string inFile, CompilationUnitSyntax inRoot)
+        private static void AnalysisDynamic(AnalysisResult inResult, CompilationUnitSyntax inRoot)
         {
             foreach (var RootMember in inRoot.Members)
             {
@@ -273,24 +265,16 @@ namespace CodeAnalysis
                                 {
                                     if (Attribute.ToString().Equals("UClass"))
                                     {
-                                        _dynamic?["DynamicClass"].Add(ClassDeclaration.Identifier.ToString());
-
-                                        if (_dynamicFile != null)
-                                        {
-                                            _dynamicFile[ClassDeclaration.Identifier.ToString()] = inFile;
-                                        }
+                                        inResult.Dynamic = ("DynamicClass",
+                                            ClassDeclaration.Identifier.ToString());
 
                                         return;
                                     }
 
                                     if (Attribute.ToString().Equals("UStruct"))
                                     {
-                                        _dynamic?["DynamicStruct"].Add(ClassDeclaration.Identifier.ToString());
-
-                                        if (_dynamicFile != null)
-                                        {
-                                            _dynamicFile[ClassDeclaration.Identifier.ToString()] = inFile;
-                                        }
+                                        inResult.Dynamic = ("DynamicStruct",
+                                            ClassDeclaration.Identifier.ToString());
 
                                         return;
                                     }
@@ -305,12 +289,8 @@ namespace CodeAnalysis
                                 {
                                     if (Attribute.ToString().Equals("UInterface"))
                                     {
-                                        _dynamic?["DynamicInterface"].Add(InterfaceDeclaration.Identifier.ToString());
-
-                                        if (_dynamicFile != null)
-                                        {
-                                            _dynamicFile[InterfaceDeclaration.Identifier.ToString()] = inFile;
-                                        }
+                                        inResult.Dynamic = ("DynamicInterface",
+                                            InterfaceDeclaration.Identifier.ToString());
 
                                         return;
                                     }
@@ -325,12 +305,8 @@ namespace CodeAnalysis
                                 {
                                     if (Attribute.ToString().Equals("UEnum"))
                                     {
-                                        _dynamic?["DynamicEnum"].Add(EnumDeclaration.Identifier.ToString());
-
-                                        if (_dynamicFile != null)
-                                        {
-                                            _dynamicFile[EnumDeclaration.Identifier.ToString()] = inFile;
-                                        }
+                                        inResult.Dynamic = ("DynamicEnum",
+                                            EnumDeclaration.Identifier.ToString());
 
                                         return;
                                     }
@@ -344,50 +320,106 @@ namespace CodeAnalysis
 
         private void WriteAll()
         {
-            File.WriteAllText(Path.Combine(_outputPathName, DynamicFileName),
-                JsonSerializer.Serialize(_dynamic,
-                    new JsonSerializerOptions
-                    {
-                        WriteIndented = true,
-                    }));
+            var Dynamic = new Dictionary<string, List<string>>
+            {
+                ["DynamicClass"] = new List<string>(),
+                ["DynamicStruct"] = new List<string>(),
+                ["DynamicEnum"] = new List<string>(),
+                ["DynamicInterface"] = new List<string>()
+            };
 
-            File.WriteAllText(Path.Combine(_outputPathName, DynamicFileFileName),
-                JsonSerializer.Serialize(_dynamicFile,
-                    new JsonSerializerOptions
-                    {
-                        WriteIndented = true,
-                    }));
+            var DynamicFile = new Dictionary<string, string>();
 
-            File.WriteAllText(Path.Combine(_outputPathName, OverrideFunctionFileName),
-                JsonSerializer.Serialize(_overrideFunction,
-                    new JsonSerializerOptions
-                    {
-                        WriteIndented = true,
-                    }));
+            var OverrideFunction = new Dictionary<string, List<string>>();
 
-            File.WriteAllText(Path.Combine(_outputPathName, OverrideFileFileName),
-                JsonSerializer.Serialize(_overrideFile,
-                    new JsonSerializerOptions
-                    {
-                        WriteIndented = true,
-                    }));
+            var OverrideFile = new Dictionary<string, string>();
+
+            foreach (var (FileName, Result) in _files)
+            {
+                if (Result.Dynamic.HasValue)
+                {
+                    var (Kind, Name) = Result.Dynamic.Value;
+
+                    Dynamic[Kind].Add(Name);
+
+                    DynamicFile[Name] = FileName;
+                }
+
+                foreach (var Item in Result.OverrideClasses)
+                {
+                    OverrideFile[Item] = FileName;
+                }
+
+                foreach (var (Key, Value) in Result.OverrideFunction)
+                {
+                    OverrideFunction[Key] = Value;
+                }
+            }
+
+            if (!Directory.Exists(_outputPathName))
+            {
+                Directory.CreateDirectory(_outputPathName);
+            }
+
+            Write(DynamicFileName, Dynamic);
+
+            Write(DynamicFileFileName, DynamicFile);
+
+            Write(OverrideFunctionFileName, OverrideFunction);
+
+            Write(OverrideFileFileName, OverrideFile);
         }
 
-        private readonly bool _bIsSingle;
+        private void Write<T>(string inFileName, T inValue)
+        {
+            var Content = JsonSerializer.Serialize(inValue,
+                new JsonSerializerOptions
+                {
+                    WriteIndented = true,
+                });
 
-        private readonly string _outputPathName;
+            var PathName = Path.Combine(_outputPathName, inFileName);
+
+            if (!_contents.TryGetValue(inFileName, out var LastContent) && File.Exists(PathName))
+            {
+                LastContent = File.ReadAllText(PathName);
+            }
+
+            // Unchanged outputs are left alone so that their timestamps stay stable
+            if (Content != LastContent)
+            {
+                File.WriteAllText(PathName, Content);
+            }
 
-        private readonly string _inputFileName;
+            _contents[inFileName] = Content;
+        }
 
-        private readonly List<string> _inputPathNames;
+        private class AnalysisResult
+        {
+            public AnalysisResult(string inHash, SyntaxTree inTree)
+            {
+                Hash = inHash;
 
-        private readonly Dictionary<string, List<string>>? _overrideFunction;
+                Tree = inTree;
+            }
 
-        private readonly Dictionary<string, string>? _overrideFile;
+            public readonly string Hash;
+
+            public readonly SyntaxTree Tree;
+
+            public (string Kind, string Name)? Dynamic;
+
+            public readonly List<string> OverrideClasses = new();
+
+            public readonly Dictionary<string, List<string>> OverrideFunction = new();
+        }
+
+        private readonly string _outputPathName;
 
-        private readonly Dictionary<string, List<string>>? _dynamic;
+        // Sorted so that the outputs do not depend on the order the files were analysed in
+        private readonly SortedDictionary<string, AnalysisResult> _files = new(StringComparer.Ordinal);
 
-        private readonly Dictionary<string, string>? _dynamicFile;
+        private readonly Dictionary<string, string> _contents = new();
 
         private const string DynamicFileName = "Dynamic.json";
 
@@ -397,4 +429,4 @@ namespace CodeAnalysis
 
         private const string OverrideFileFileName = "OverrideFile.json";
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,41 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Script.CoreUObject
+{
+    /*
+     * Pooled chunk for container enumerators. Enumerators are structs, so every copy holds the same lease,
+     * the version is bumped on return and a copy that is disposed again no longer matches it.
+     */
+    internal sealed class ChunkLease<T>
+    {
+        private const int ChunkSize = 64;
+
+        public static ChunkLease<T> Rent()
+        {
+            Pool ??= new Stack<ChunkLease<T>>();
+
+            return Pool.Count > 0 ? Pool.Pop() : new ChunkLease<T>();
+        }
+
+        public static void Return(ChunkLease<T> InLease, int InVersion)
+        {
+            if (InLease == null || InLease.Version != InVersion)
+            {
+                return;
+            }
+
+            ++InLease.Version;
+
+            Pool ??= new Stack<ChunkLease<T>>();
+
+            Pool.Push(InLease);
+        }
+
+        public T[] Chunk { get; } = new T[ChunkSize];
+
+        public int Version { get; private set; }
+
+        [ThreadStatic] private static Stack<ChunkLease<T>> Pool;
+    }
+}
@@ -1,5 +1,7 @@
-﻿using System.Collections;
+﻿using System;
+using System.Collections;
 using System.Collections.Generic;
+using System.Runtime.CompilerServices;
 using Script.Library;
 
 namespace Script.CoreUObject
@@ -24,20 +26,108 @@ namespace Script.CoreUObject
 
         public override int GetHashCode() => (int)GarbageCollectionHandle;
 
-        public IEnumerator<T> GetEnumerator()
+        public Enumerator GetEnumerator() => new(this);
+
+        IEnumerator<T> IEnumerable<T>.GetEnumerator() => GetEnumerator();
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+        /*
+         * Blittable elements are copied into a pooled chunk, other elements are fetched one by one.
+         */
+        public struct Enumerator : IEnumerator<T>
         {
-            for (var Index = 0; Index < Num(); Index++)
+            internal Enumerator(TArray<T> InArray)
             {
-                yield return this[Index];
+                Array = InArray;
+
+                Lease = IsBlittable ? ChunkLease<T>.Rent() : null;
+
+                LeaseVersion = Lease?.Version ?? 0;
+
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
+
+                CurrentValue = default;
             }
-        }
 
-        IEnumerator IEnumerable.GetEnumerator()
-        {
-            for (var Index = 0; Index < Num(); Index++)
+            public bool MoveNext()
+            {
+                if (Lease == null)
+                {
+                    if (Index >= Array.Num())
+                    {
+                        return false;
+                    }
+
+                    CurrentValue = Array[Index++];
+
+                    return true;
+                }
+
+                if (++ChunkIndex >= ChunkNum)
+                {
+                    ChunkNum = Array.CopyTo(Lease.Chunk, Index);
+
+                    Index += ChunkNum;
+
+                    ChunkIndex = 0;
+
+                    if (ChunkNum == 0)
+                    {
+                        // Nothing is copied either at the end or when the element does not have the layout of T
+                        if (Index < Array.Num())
+                        {
+                            Dispose();
+
+                            return MoveNext();
+                        }
+
+                        return false;
+                    }
+                }
+
+                CurrentValue = Lease.Chunk[ChunkIndex];
+
+                return true;
+            }
+
+            public void Reset()
             {
-                yield return this[Index];
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
             }
+
+            public T Current => CurrentValue;
+
+            object IEnumerator.Current => Current;
+
+            public void Dispose()
+            {
+                ChunkLease<T>.Return(Lease, LeaseVersion);
+
+                Lease = null;
+            }
+
+            private readonly TArray<T> Array;
+
+            private ChunkLease<T> Lease;
+
+            private readonly int LeaseVersion;
+
+            private int Index;
+
+            private int ChunkNum;
+
+            private int ChunkIndex;
+
+            private T CurrentValue;
         }
 
         public int GetTypeSize() => TArrayImplementation.TArray_GetTypeSizeImplementation(GarbageCollectionHandle);
@@ -296,6 +386,104 @@ namespace Script.CoreUObject
             TArrayImplementation.TArray_SwapImplementation(GarbageCollectionHandle, InFirstIndexToSwap,
                 InSecondIndexToSwap);
 
+        // Elements that are primitives, enums or blittable structs share their layout with the native buffer
+        private static readonly bool IsBlittable = !RuntimeHelpers.IsReferenceOrContainsReferences<T>();
+
+        /*
+         * Direct view of the native buffer, which is not moved by the managed GC.
+         * The view is only valid until the array is resized or destroyed.
+         */
+        public Span<T> AsSpan()
+        {
+            unsafe
+            {
+                if (IsBlittable)
+                {
+                    var Count = Num();
+
+                    // An empty array may have no buffer at all
+                    if (Count == 0)
+                    {
+                        return Span<T>.Empty;
+                    }
+
+                    var Data = TArrayImplementation.TArray_GetDataImplementation(GarbageCollectionHandle, sizeof(T));
+
+                    if (Data != null)
+                    {
+                        return new Span<T>(Data, Count);
+                    }
+                }
+
+                throw new NotSupportedException($"TArray<{typeof(T).Name}> is not blittable");
+            }
+        }
+
+        public ReadOnlySpan<T> AsReadOnlySpan() => AsSpan();
+
+        public int CopyTo(Span<T> OutValues, int InIndex = 0)
+        {
+            unsafe
+            {
+                if (IsBlittable)
+                {
+                    fixed (T* Buffer = OutValues)
+                    {
+                        var Count = TArrayImplementation.TArray_CopyToImplementation(GarbageCollectionHandle, Buffer,
+                            InIndex, OutValues.Length, sizeof(T));
+
+                        if (Count > 0 || OutValues.IsEmpty || !IsValidIndex(InIndex))
+                        {
+                            return Count;
+                        }
+                    }
+                }
+
+                var CopyCount = Math.Min(OutValues.Length, Math.Max(Num() - InIndex, 0));
+
+                for (var Index = 0; Index < CopyCount; Index++)
+                {
+                    OutValues[Index] = this[InIndex + Index];
+                }
+
+                return CopyCount;
+            }
+        }
+
+        public void CopyFrom(ReadOnlySpan<T> InValues)
+        {
+            unsafe
+            {
+                if (IsBlittable)
+                {
+                    fixed (T* Buffer = InValues)
+                    {
+                        if (TArrayImplementation.TArray_CopyFromImplementation(GarbageCollectionHandle, Buffer,
+                                InValues.Length, sizeof(T)))
+                        {
+                            return;
+                        }
+                    }
+                }
+
+                SetNum(InValues.Length);
+
+                for (var Index = 0; Index < InValues.Length; Index++)
+                {
+                    this[Index] = InValues[Index];
+                }
+            }
+        }
+
+        public T[] ToArray()
+        {
+            var Values = new T[Num()];
+
+            CopyTo(Values);
+
+            return Values;
+        }
+
         public nint GarbageCollectionHandle { get; set; }
     }
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
-﻿using System.Collections;
+﻿using System;
+using System.Buffers;
+using System.Collections;
 using System.Collections.Generic;
+using System.Runtime.CompilerServices;
 using Script.Library;
 
 namespace Script.CoreUObject
@@ -10,20 +13,146 @@ namespace Script.CoreUObject
 
         ~TMap() => TMapImplementation.TMap_UnRegisterImplementation(GarbageCollectionHandle);
 
-        public IEnumerator<KeyValuePair<TKey, TValue>> GetEnumerator()
+        public Enumerator GetEnumerator() => new(this);
+
+        IEnumerator<KeyValuePair<TKey, TValue>> IEnumerable<KeyValuePair<TKey, TValue>>.GetEnumerator() =>
+            GetEnumerator();
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+        /*
+         * Pairs with blittable keys and values are fetched into pooled chunks, other pairs are fetched one by one.
+         * Either way the native side skips the holes of the sparse array.
+         */
+        public struct Enumerator : IEnumerator<KeyValuePair<TKey, TValue>>
         {
-            for (var Index = 0; Index < GetMaxIndex(); Index++)
+            internal Enumerator(TMap<TKey, TValue> InMap)
             {
-                if (IsValidIndex(Index))
+                Map = InMap;
+
+                KeyLease = IsBlittable ? ChunkLease<TKey>.Rent() : null;
+
+                ValueLease = IsBlittable ? ChunkLease<TValue>.Rent() : null;
+
+                KeyLeaseVersion = KeyLease?.Version ?? 0;
+
+                ValueLeaseVersion = ValueLease?.Version ?? 0;
+
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
+
+                CurrentValue = default;
+            }
+
+            public bool MoveNext()
+            {
+                unsafe
                 {
-                    yield return new KeyValuePair<TKey, TValue>(GetEnumeratorKey(Index), GetEnumeratorValue(Index));
+                    var NextIndex = Index;
+
+                    if (KeyLease == null)
+                    {
+                        var KeyBuffer = stackalloc byte[typeof(TKey).IsValueType ? sizeof(TKey) : sizeof(nint)];
+
+                        var ValueBuffer = stackalloc byte[typeof(TValue).IsValueType ? sizeof(TValue) : sizeof(nint)];
+
+                        var Count = TMapImplementation.TMap_EnumerateImplementation(Map.GarbageCollectionHandle,
+                            &NextIndex, KeyBuffer, ValueBuffer, 1, 0, 0);
+
+                        Index = NextIndex;
+
+                        if (Count == 0)
+                        {
+                            return false;
+                        }
+
+                        CurrentValue = new KeyValuePair<TKey, TValue>(*(TKey*)KeyBuffer, *(TValue*)ValueBuffer);
+
+                        return true;
+                    }
+
+                    if (++ChunkIndex >= ChunkNum)
+                    {
+                        fixed (TKey* KeyBuffer = KeyLease.Chunk)
+                        {
+                            fixed (TValue* ValueBuffer = ValueLease!.Chunk)
+                            {
+                                ChunkNum = TMapImplementation.TMap_EnumerateImplementation(
+                                    Map.GarbageCollectionHandle, &NextIndex, (byte*)KeyBuffer, (byte*)ValueBuffer,
+                                    Math.Min(KeyLease.Chunk.Length, ValueLease.Chunk.Length), sizeof(TKey),
+                                    sizeof(TValue));
+                            }
+                        }
+
+                        // The native side refuses raw copies when a pair does not have the layout of TKey and TValue
+                        if (ChunkNum < 0)
+                        {
+                            Dispose();
+
+                            return MoveNext();
+                        }
+
+                        Index = NextIndex;
+
+                        ChunkIndex = 0;
+
+                        if (ChunkNum == 0)
+                        {
+                            return false;
+                        }
+                    }
+
+                    CurrentValue = new KeyValuePair<TKey, TValue>(KeyLease.Chunk[ChunkIndex],
+                        ValueLease.Chunk[ChunkIndex]);
+
+                    return true;
                 }
             }
-        }
 
-        IEnumerator IEnumerable.GetEnumerator()
-        {
-            return GetEnumerator();
+            public void Reset()
+            {
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
+            }
+
+            public KeyValuePair<TKey, TValue> Current => CurrentValue;
+
+            object IEnumerator.Current => Current;
+
+            public void Dispose()
+            {
+                ChunkLease<TKey>.Return(KeyLease, KeyLeaseVersion);
+
+                ChunkLease<TValue>.Return(ValueLease, ValueLeaseVersion);
+
+                KeyLease = null;
+
+                ValueLease = null;
+            }
+
+            private readonly TMap<TKey, TValue> Map;
+
+            private ChunkLease<TKey> KeyLease;
+
+            private ChunkLease<TValue> ValueLease;
+
+            private readonly int KeyLeaseVersion;
+
+            private readonly int ValueLeaseVersion;
+
+            private int Index;
+
+            private int ChunkNum;
+
+            private int ChunkIndex;
+
+            private KeyValuePair<TKey, TValue> CurrentValue;
         }
 
         public void Empty(int InExpectedNumElements = 0) =>
@@ -94,6 +223,68 @@ namespace Script.CoreUObject
             }
         }
 
+        public void Append(IReadOnlyCollection<KeyValuePair<TKey, TValue>> InPairs)
+        {
+            unsafe
+            {
+                var KeySize = typeof(TKey).IsValueType ? sizeof(TKey) : sizeof(nint);
+
+                var ValueSize = typeof(TValue).IsValueType ? sizeof(TValue) : sizeof(nint);
+
+                // The buffers only live for the call, so they are rented instead of allocated per batch
+                var KeyBuffer = ArrayPool<byte>.Shared.Rent(KeySize * InPairs.Count);
+
+                var ValueBuffer = ArrayPool<byte>.Shared.Rent(ValueSize * InPairs.Count);
+
+                var Num = 0;
+
+                try
+                {
+                    fixed (byte* KeyData = KeyBuffer, ValueData = ValueBuffer)
+                    {
+                        foreach (var Pair in InPairs)
+                        {
+                            if (Num == InPairs.Count)
+                            {
+                                break;
+                            }
+
+                            if (typeof(TKey).IsValueType)
+                            {
+                                *(TKey*)(KeyData + Num * KeySize) = Pair.Key;
+                            }
+                            else
+                            {
+                                *(nint*)(KeyData + Num * KeySize) =
+                                    (Pair.Key as IGarbageCollectionHandle)!.GarbageCollectionHandle;
+                            }
+
+                            if (typeof(TValue).IsValueType)
+                            {
+                                *(TValue*)(ValueData + Num * ValueSize) = Pair.Value;
+                            }
+                            else
+                            {
+                                *(nint*)(ValueData + Num * ValueSize) =
+                                    (Pair.Value as IGarbageCollectionHandle)!.GarbageCollectionHandle;
+                            }
+
+                            Num++;
+                        }
+
+                        TMapImplementation.TMap_AppendImplementation(GarbageCollectionHandle, Num, KeyData,
+                            ValueData);
+                    }
+                }
+                finally
+                {
+                    ArrayPool<byte>.Shared.Return(KeyBuffer);
+
+                    ArrayPool<byte>.Shared.Return(ValueBuffer);
+                }
+            }
+        }
+
         public int Remove(TKey InKey)
         {
             unsafe
@@ -391,60 +582,9 @@ namespace Script.CoreUObject
             }
         }
 
-        private int GetMaxIndex() => TMapImplementation.TMap_GetMaxIndexImplementation(GarbageCollectionHandle);
-
-        private bool IsValidIndex(int InIndex) =>
-            TMapImplementation.TMap_IsValidIndexImplementation(GarbageCollectionHandle, InIndex);
-
-        private TKey GetEnumeratorKey(int InIndex)
-        {
-            unsafe
-            {
-                if (typeof(TKey).IsValueType)
-                {
-                    var ReturnBuffer = stackalloc byte[sizeof(TKey)];
-
-                    TMapImplementation.TMap_GetEnumeratorKeyImplementation(GarbageCollectionHandle, InIndex,
-                        ReturnBuffer);
-
-                    return *(TKey*)ReturnBuffer;
-                }
-                else
-                {
-                    var ReturnBuffer = stackalloc byte[sizeof(nint)];
-
-                    TMapImplementation.TMap_GetEnumeratorKeyImplementation(GarbageCollectionHandle, InIndex,
-                        ReturnBuffer);
-
-                    return *(TKey*)ReturnBuffer;
-                }
-            }
-        }
-
-        private TValue GetEnumeratorValue(int InIndex)
-        {
-            unsafe
-            {
-                if (typeof(TValue).IsValueType)
-                {
-                    var ReturnBuffer = stackalloc byte[sizeof(TValue)];
-
-                    TMapImplementation.TMap_GetEnumeratorValueImplementation(GarbageCollectionHandle, InIndex,
-                        ReturnBuffer);
-
-                    return *(TValue*)ReturnBuffer;
-                }
-                else
-                {
-                    var ReturnBuffer = stackalloc byte[sizeof(nint)];
-
-                    TMapImplementation.TMap_GetEnumeratorValueImplementation(GarbageCollectionHandle, InIndex,
-                        ReturnBuffer);
-
-                    return *(TValue*)ReturnBuffer;
-                }
-            }
-        }
+        // Keys and values that are primitives, enums or blittable structs are copied raw by the native side
+        private static readonly bool IsBlittable = !RuntimeHelpers.IsReferenceOrContainsReferences<TKey>() &&
+                                                   !RuntimeHelpers.IsReferenceOrContainsReferences<TValue>();
 
         public nint GarbageCollectionHandle { get; set; }
     }
@@ -1,5 +1,7 @@
-﻿using System.Collections;
+﻿using System.Buffers;
+using System.Collections;
 using System.Collections.Generic;
+using System.Runtime.CompilerServices;
 using Script.Library;
 
 namespace Script.CoreUObject
@@ -10,26 +12,125 @@ namespace Script.CoreUObject
 
         ~TSet() => TSetImplementation.TSet_UnRegisterImplementation(GarbageCollectionHandle);
 
-        public IEnumerator<T> GetEnumerator()
+        public Enumerator GetEnumerator() => new(this);
+
+        IEnumerator<T> IEnumerable<T>.GetEnumerator() => GetEnumerator();
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+        /*
+         * Blittable elements are fetched into a pooled chunk, other elements are fetched one by one.
+         * Either way the native side skips the holes of the sparse array.
+         */
+        public struct Enumerator : IEnumerator<T>
         {
-            for (var Index = 0; Index < Num(); Index++)
+            internal Enumerator(TSet<T> InSet)
             {
-                if (IsValidIndex(Index))
-                {
-                    yield return this[Index];
-                }
+                Set = InSet;
+
+                Lease = IsBlittable ? ChunkLease<T>.Rent() : null;
+
+                LeaseVersion = Lease?.Version ?? 0;
+
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
+
+                CurrentValue = default;
             }
-        }
 
-        IEnumerator IEnumerable.GetEnumerator()
-        {
-            for (var Index = 0; Index < Num(); Index++)
+            public bool MoveNext()
             {
-                if (IsValidIndex(Index))
+                unsafe
                 {
-                    yield return this[Index];
+                    var NextIndex = Index;
+
+                    if (Lease == null)
+                    {
+                        var ValueBuffer = stackalloc byte[typeof(T).IsValueType ? sizeof(T) : sizeof(nint)];
+
+                        var Count = TSetImplementation.TSet_EnumerateImplementation(Set.GarbageCollectionHandle,
+                            &NextIndex, ValueBuffer, 1, 0);
+
+                        Index = NextIndex;
+
+                        if (Count == 0)
+                        {
+                            return false;
+                        }
+
+                        CurrentValue = *(T*)ValueBuffer;
+
+                        return true;
+                    }
+
+                    if (++ChunkIndex >= ChunkNum)
+                    {
+                        fixed (T* ValueBuffer = Lease.Chunk)
+                        {
+                            ChunkNum = TSetImplementation.TSet_EnumerateImplementation(Set.GarbageCollectionHandle,
+                                &NextIndex, (byte*)ValueBuffer, Lease.Chunk.Length, sizeof(T));
+                        }
+
+                        // The native side refuses raw copies when the element does not have the layout of T
+                        if (ChunkNum < 0)
+                        {
+                            Dispose();
+
+                            return MoveNext();
+                        }
+
+                        Index = NextIndex;
+
+                        ChunkIndex = 0;
+
+                        if (ChunkNum == 0)
+                        {
+                            return false;
+                        }
+                    }
+
+                    CurrentValue = Lease.Chunk[ChunkIndex];
+
+                    return true;
                 }
             }
+
+            public void Reset()
+            {
+                Index = 0;
+
+                ChunkNum = 0;
+
+                ChunkIndex = 0;
+            }
+
+            public T Current => CurrentValue;
+
+            object IEnumerator.Current => Current;
+
+            public void Dispose()
+            {
+                ChunkLease<T>.Return(Lease, LeaseVersion);
+
+                Lease = null;
+            }
+
+            private readonly TSet<T> Set;
+
+            private ChunkLease<T> Lease;
+
+            private readonly int LeaseVersion;
+
+            private int Index;
+
+            private int ChunkNum;
+
+            private int ChunkIndex;
+
+            private T CurrentValue;
         }
 
         public void Empty(int InExpectedNumElements = 0) =>
@@ -64,6 +165,51 @@ namespace Script.CoreUObject
             }
         }
 
+        public void Append(IReadOnlyCollection<T> InValues)
+        {
+            unsafe
+            {
+                var ValueSize = typeof(T).IsValueType ? sizeof(T) : sizeof(nint);
+
+                // The buffer only lives for the call, so it is rented instead of allocated per batch
+                var ValueBuffer = ArrayPool<byte>.Shared.Rent(ValueSize * InValues.Count);
+
+                var Num = 0;
+
+                try
+                {
+                    fixed (byte* ValueData = ValueBuffer)
+                    {
+                        foreach (var Value in InValues)
+                        {
+                            if (Num == InValues.Count)
+                            {
+                                break;
+                            }
+
+                            if (typeof(T).IsValueType)
+                            {
+                                *(T*)(ValueData + Num * ValueSize) = Value;
+                            }
+                            else
+                            {
+                                *(nint*)(ValueData + Num * ValueSize) =
+                                    (Value as IGarbageCollectionHandle)!.GarbageCollectionHandle;
+                            }
+
+                            Num++;
+                        }
+
+                        TSetImplementation.TSet_AppendImplementation(GarbageCollectionHandle, Num, ValueData);
+                    }
+                }
+                finally
+                {
+                    ArrayPool<byte>.Shared.Return(ValueBuffer);
+                }
+            }
+        }
+
         public int Remove(T InValue)
         {
             unsafe
@@ -110,36 +256,8 @@ namespace Script.CoreUObject
             }
         }
 
-        private bool IsValidIndex(int InIndex) =>
-            TSetImplementation.TSet_IsValidIndexImplementation(GarbageCollectionHandle, InIndex);
-
-        private T this[int InIndex]
-        {
-            get
-            {
-                unsafe
-                {
-                    if (typeof(T).IsValueType)
-                    {
-                        var ValueBuffer = stackalloc byte[sizeof(T)];
-
-                        TSetImplementation.TSet_GetEnumeratorImplementation(GarbageCollectionHandle, InIndex,
-                            ValueBuffer);
-
-                        return *(T*)ValueBuffer;
-                    }
-                    else
-                    {
-                        var ValueBuffer = stackalloc byte[sizeof(nint)];
-
-                        TSetImplementation.TSet_GetEnumeratorImplementation(GarbageCollectionHandle, InIndex,
-                            ValueBuffer);
-
-                        return *(T*)ValueBuffer;
-                    }
-                }
-            }
-        }
+        // Elements that are primitives, enums or blittable structs are copied raw by the native side
+        private static readonly bool IsBlittable = !RuntimeHelpers.IsReferenceOrContainsReferences<T>();
 
         public nint GarbageCollectionHandle { get; set; }
     }
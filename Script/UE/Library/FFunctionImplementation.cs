@@ -99,5 +99,72 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void FFunction_GenericCall26Implementation(nint InMonoObject, uint InFunctionHash,
             byte* InBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall0Implementation(uint InFunctionHash);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall1Implementation(uint InFunctionHash, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall1Implementation(uint InFunctionHash, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall2Implementation(uint InFunctionHash, byte* InBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall3Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall3Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall4Implementation(uint InFunctionHash, byte* OutBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall6Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall7Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall7Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall8Implementation(uint InFunctionHash);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall9Implementation(uint InFunctionHash, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall9Implementation(uint InFunctionHash, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall10Implementation(uint InFunctionHash, byte* InBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall11Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall11Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticGenericCall14Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticPrimitiveCall15Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void FFunction_StaticCompoundCall15Implementation(uint InFunctionHash,
+            byte* InBuffer, byte* OutBuffer, byte* ReturnBuffer);
     }
 }
\ No newline at end of file
@@ -92,6 +92,17 @@ namespace Script.Library
         public static extern void TArray_SwapImplementation(nint InArray, int InFirstIndexToSwap,
             int InSecondIndexToSwap);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void* TArray_GetDataImplementation(nint InArray, int InTypeSize);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern int TArray_CopyToImplementation(nint InArray, void* OutBuffer, int InIndex, int InCount,
+            int InTypeSize);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool TArray_CopyFromImplementation(nint InArray, void* InBuffer, int InCount,
+            int InTypeSize);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern int TArray_INDEX_NONEImplementation();
     }
@@ -23,6 +23,10 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void TMap_AddImplementation(nint InMap, byte* InKeyBuffer, byte* InValueBuffer);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void TMap_AppendImplementation(nint InMap, int InNum, byte* InKeyBuffer,
+            byte* InValueBuffer);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern int TMap_RemoveImplementation(nint InMap, byte* InKeyBuffer);
 
@@ -52,5 +56,9 @@ namespace Script.Library
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void TMap_GetEnumeratorValueImplementation(nint InMap, int InIndex, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern int TMap_EnumerateImplementation(nint InMap, int* InOutIndex, byte* OutKeyBuffer,
+            byte* OutValueBuffer, int InCount, int InKeyTypeSize, int InValueTypeSize);
     }
 }
\ No newline at end of file
@@ -26,6 +26,9 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void TSet_AddImplementation(nint InSet, byte* InValueBuffer);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void TSet_AppendImplementation(nint InSet, int InNum, byte* InValueBuffer);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern int TSet_RemoveImplementation(nint InSet, byte* InValueBuffer);
 
@@ -37,5 +40,9 @@ namespace Script.Library
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void TSet_GetEnumeratorImplementation(nint InSet, int Index, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern int TSet_EnumerateImplementation(nint InSet, int* InOutIndex, byte* OutBuffer, int InCount,
+            int InTypeSize);
     }
 }
\ No newline at end of file
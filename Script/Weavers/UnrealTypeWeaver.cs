@@ -18,6 +18,18 @@ namespace Weavers
 
         private readonly List<TypeDefinition> _interfaceTypes = new List<TypeDefinition>();
 
+        // Must match FUnrealCSharpFunctionLibrary::IsBlittableStruct, other structs are still marshaled by handle
+        private static readonly HashSet<string> BlittableStructs = new HashSet<string>
+        {
+            "Script.CoreUObject.FVector",
+            "Script.CoreUObject.FVector2D",
+            "Script.CoreUObject.FRotator",
+            "Script.CoreUObject.FLinearColor",
+            "Script.CoreUObject.FColor",
+            "Script.CoreUObject.FIntPoint",
+            "Script.CoreUObject.FIntVector"
+        };
+
         private MethodDefinition _getObjectPropertyImplementation;
 
         private MethodDefinition _setObjectPropertyImplementation;
@@ -343,7 +355,7 @@ namespace Weavers
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Nop));
 
-                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Conv_U));
 
@@ -441,7 +453,7 @@ namespace Weavers
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Nop));
 
-                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Conv_U));
 
@@ -547,7 +559,7 @@ namespace Weavers
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Nop));
 
-                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Conv_U));
 
@@ -645,7 +657,7 @@ namespace Weavers
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Nop));
 
-                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                ilProcessor.Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                 ilProcessor.Append(Instruction.Create(OpCodes.Conv_U));
 
@@ -704,7 +716,7 @@ namespace Weavers
             }
         }
 
-        private static Instruction GetTypeStind(TypeReference Type)
+        private Instruction GetTypeStind(TypeReference Type)
         {
             switch (Type.MetadataType)
             {
@@ -737,6 +749,11 @@ namespace Weavers
                         return GetTypeStind(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    if (IsBlittableStruct(Type))
+                    {
+                        return Instruction.Create(OpCodes.Stobj, ModuleDefinition.ImportReference(Type));
+                    }
+
                     break;
                 }
             }
@@ -744,7 +761,7 @@ namespace Weavers
             return Instruction.Create(OpCodes.Stind_I);
         }
 
-        private static Instruction GetTypeLdind(TypeReference Type)
+        private Instruction GetTypeLdind(TypeReference Type)
         {
             switch (Type.MetadataType)
             {
@@ -777,6 +794,11 @@ namespace Weavers
                         return GetTypeLdind(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    if (IsBlittableStruct(Type))
+                    {
+                        return Instruction.Create(OpCodes.Ldobj, ModuleDefinition.ImportReference(Type));
+                    }
+
                     break;
                 }
             }
@@ -784,7 +806,7 @@ namespace Weavers
             return Instruction.Create(OpCodes.Ldind_Ref);
         }
 
-        private static sbyte GetTypeSize(TypeReference Type)
+        private static int GetTypeSize(TypeReference Type)
         {
             switch (Type.MetadataType)
             {
@@ -816,11 +838,25 @@ namespace Weavers
                         return GetTypeSize(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    if (IsBlittableStruct(Type))
+                    {
+                        return Type.Resolve().ClassSize;
+                    }
+
                     break;
                 }
             }
 
-            return (sbyte)IntPtr.Size;
+            return IntPtr.Size;
+        }
+
+        private static bool IsBlittableStruct(TypeReference Type)
+        {
+            var Definition = Type.Resolve();
+
+            return Definition != null && Definition.IsValueType && !Definition.IsEnum &&
+                   BlittableStructs.Contains(Definition.FullName) && Definition.IsExplicitLayout &&
+                   Definition.ClassSize > 0;
         }
 
         private void ModifyRpcMethod(TypeDefinition Type, MethodDefinition Method)
@@ -834,7 +870,7 @@ namespace Weavers
 
             if (Method.Parameters.Count > 0)
             {
-                sbyte BufferSize = 0;
+                var BufferSize = 0;
 
                 foreach (var param in Method.Parameters)
                 {
@@ -849,7 +885,7 @@ namespace Weavers
 
                 Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Nop));
 
-                Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                 Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Conv_U));
 
@@ -865,7 +901,7 @@ namespace Weavers
 
                     if (BufferSize != 0)
                     {
-                        Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Ldc_I4_S, BufferSize));
+                        Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Ldc_I4, BufferSize));
 
                         Method.Body.GetILProcessor().Append(Instruction.Create(OpCodes.Add));
                     }
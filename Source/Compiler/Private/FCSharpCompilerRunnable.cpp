@@ -3,8 +3,10 @@
 #include "Delegate/FUnrealCSharpCoreModuleDelegates.h"
 #include "Dynamic/FDynamicGenerator.h"
 #include "Log/UnrealCSharpLog.h"
+#include "Misc/FileHelper.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Setting/UnrealCSharpEditorSetting.h"
+#include "Setting/UnrealCSharpSetting.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "UEVersion.h"
 #if UE_APP_STYLE_GET_BRUSH
@@ -17,7 +19,8 @@ FCSharpCompilerRunnable::FCSharpCompilerRunnable():
 	Event(nullptr),
 	bIsCompiling(false),
 	bIsGenerating(false),
-	bIsStopped(false)
+	bIsStopped(false),
+	bIsRestored(false)
 {
 	OnBeginGeneratorDelegateHandle = FUnrealCSharpCoreModuleDelegates::OnBeginGenerator.AddRaw(
 		this, &FCSharpCompilerRunnable::OnBeginGenerator);
@@ -41,7 +44,7 @@ FCSharpCompilerRunnable::~FCSharpCompilerRunnable()
 
 bool FCSharpCompilerRunnable::Init()
 {
-	Event = FPlatformProcess::GetSynchEventFromPool(true);
+	Event = FPlatformProcess::GetSynchEventFromPool(false);
 
 	return FRunnable::Init();
 }
@@ -55,32 +58,29 @@ uint32 FCSharpCompilerRunnable::Run()
 			return 0;
 		}
 
-		if (!bIsGenerating)
+		if (!bIsGenerating && !Tasks.IsEmpty())
 		{
-			if (!Tasks.IsEmpty())
+			bool Task = false;
+
 			{
-				bool Task = false;
+				FScopeLock ScopeLock(&CriticalSection);
 
+				if (!Tasks.IsEmpty())
 				{
-					FScopeLock ScopeLock(&CriticalSection);
-
-					if (!Tasks.IsEmpty())
-					{
-						Tasks.Dequeue(Task);
-					}
+					Tasks.Dequeue(Task);
 				}
+			}
 
-				if (Task == true)
-				{
-					DoWork();
-				}
+			if (Task == true)
+			{
+				DoWork();
 			}
-			else
+		}
+		else
+		{
+			if (Event != nullptr)
 			{
-				if (Event != nullptr)
-				{
-					Event->Wait();
-				}
+				Event->Wait();
 			}
 		}
 	}
@@ -219,47 +219,44 @@ void FCSharpCompilerRunnable::Compile()
 
 	static auto CompileTool = FUnrealCSharpFunctionLibrary::GetDotNet();
 
-	const auto CompileParam = FString::Printf(TEXT(
-		"publish \"%s\" --nologo -c Debug -o \"%s\""
-	),
-	                                          *FUnrealCSharpFunctionLibrary::GetGameProjectPath(),
-	                                          *FUnrealCSharpFunctionLibrary::GetFullPublishDirectory()
-	);
+	static auto LogFile = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("UnrealCSharp_Compile.log")));
 
-	void* ReadPipe = nullptr;
+	auto ReturnCode = 0;
 
-	void* WritePipe = nullptr;
+	if (!bIsRestored)
+	{
+		const auto RestoreParam = FString::Printf(TEXT(
+			"restore \"%s\" --nologo"
+		),
+		                                          *FUnrealCSharpFunctionLibrary::GetGameProjectPath()
+		);
 
-	auto OutProcessID = 0u;
+		bIsRestored = CreateProc(CompileTool, RestoreParam, ReturnCode) && ReturnCode == 0;
+	}
 
-	FString Result;
+	// Node reuse and shared compilation keep MSBuild and the Roslyn compiler server alive between compiles,
+	// so only the first compile pays for process startup and every later one builds incrementally.
+	// The servers are shared with every other dotnet build on the machine and exit on their own once idle
+	const auto CompileParam = FString::Printf(TEXT(
+		"publish \"%s\" --nologo %s -c Debug -o \"%s\" -nodeReuse:true -p:UseSharedCompilation=true -noConsoleLogger -fileLogger -fileLoggerParameters:LogFile=\"%s\";Verbosity=minimal"
+	),
+	                                          *FUnrealCSharpFunctionLibrary::GetGameProjectPath(),
+	                                          bIsRestored ? TEXT("--no-restore") : TEXT(""),
+	                                          *FUnrealCSharpFunctionLibrary::GetFullPublishDirectory(),
+	                                          *LogFile
+	);
 
-	FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+	const auto bIsCreated = CreateProc(CompileTool, CompileParam, ReturnCode);
 
-	auto ProcessHandle = FPlatformProcess::CreateProc(
-		*CompileTool,
-		*CompileParam,
-		false,
-		true,
-		true,
-		&OutProcessID,
-		1,
-		nullptr,
-		WritePipe,
-		ReadPipe);
-
-	while (ProcessHandle.IsValid() && FPlatformProcess::IsApplicationRunning(OutProcessID))
+	if (bIsCreated && ReturnCode == 0 && IsRunningCookCommandlet())
 	{
-		FPlatformProcess::Sleep(0.01f);
-
-		Result.Append(FPlatformProcess::ReadPipe(ReadPipe));
+		AotCompile();
 	}
 
 	FNotificationInfo* NotificationInfo{};
 
-	auto ReturnCode = 0;
-
-	if (FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+	if (bIsCreated)
 	{
 		[[maybe_unused]] static const FName CompileStatusUnknown("Blueprint.CompileStatus.Overlay.Unknown");
 
@@ -293,14 +290,14 @@ void FCSharpCompilerRunnable::Compile()
 			NotificationInfo->Image = FEditorStyle::GetBrush(CompileStatusError);
 #endif
 
+			FString Result;
+
+			FFileHelper::LoadFileToString(Result, *LogFile);
+
 			UE_LOG(LogUnrealCSharp, Error, TEXT("%s"), *Result);
 		}
 	}
 
-	FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-
-	FPlatformProcess::CloseProc(ProcessHandle);
-
 	AsyncTask(ENamedThreads::GameThread, [this, NotificationInfo]()
 	{
 		if (NotificationItem.IsValid())
@@ -323,6 +320,125 @@ void FCSharpCompilerRunnable::Compile()
 	});
 }
 
+void FCSharpCompilerRunnable::AotCompile() const
+{
+	const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+		UUnrealCSharpEditorSetting>();
+
+	if (UnrealCSharpEditorSetting == nullptr || !UnrealCSharpEditorSetting->EnableAotCompile())
+	{
+		return;
+	}
+
+	const auto AotCompiler = FPaths::ConvertRelativePathToFull(UnrealCSharpEditorSetting->GetAotCompilerPath().FilePath);
+
+	if (!FPaths::FileExists(AotCompiler))
+	{
+		UE_LOG(LogUnrealCSharp, Error, TEXT("AOT compiler %s does not exist"), *AotCompiler);
+
+		return;
+	}
+
+	TArray<FString> AotOptions;
+
+	if (const auto UnrealCSharpSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<UUnrealCSharpSetting>())
+	{
+		if (UnrealCSharpSetting->GetAotMode() == EMonoAotMode::Hybrid)
+		{
+			AotOptions.Add(TEXT("hybrid"));
+		}
+	}
+
+	if (UnrealCSharpEditorSetting->EnableAotLLVM())
+	{
+		AotOptions.Add(TEXT("llvm"));
+	}
+
+	// References are resolved against the publish directory, any framework path the cross compiler needs
+	// is taken from the MONO_PATH of the cook environment
+	const auto EnvironmentMonoPath = FPlatformMisc::GetEnvironmentVariable(TEXT("MONO_PATH"));
+
+	auto MonoPath = FUnrealCSharpFunctionLibrary::GetFullPublishDirectory();
+
+	if (!EnvironmentMonoPath.IsEmpty())
+	{
+		MonoPath += FPlatformMisc::GetPathVarDelimiter() + EnvironmentMonoPath;
+	}
+
+	// Only the compiler processes see the extended path, it is restored once they have been spawned
+	FPlatformMisc::SetEnvironmentVar(TEXT("MONO_PATH"), *MonoPath);
+
+	for (const auto& AssemblyPath : FUnrealCSharpFunctionLibrary::GetFullAssemblyPublishPath())
+	{
+		if (!FPaths::FileExists(AssemblyPath))
+		{
+			continue;
+		}
+
+		// The image is written next to the assembly as <assembly>.so, where the runtime looks it up
+		AotOptions.Add(FString::Printf(TEXT("outfile=%s.so"), *AssemblyPath));
+
+		const auto AotParam = FString::Printf(TEXT(
+			"--aot=%s \"%s\""
+		),
+		                                      *FString::Join(AotOptions, TEXT(",")),
+		                                      *AssemblyPath
+		);
+
+		AotOptions.Pop();
+
+		auto ReturnCode = 0;
+
+		if (!CreateProc(AotCompiler, AotParam, ReturnCode) || ReturnCode != 0)
+		{
+			UE_LOG(LogUnrealCSharp, Error, TEXT("AOT compile %s failed with %d"), *AssemblyPath, ReturnCode);
+		}
+	}
+
+	FPlatformMisc::SetEnvironmentVar(TEXT("MONO_PATH"), *EnvironmentMonoPath);
+}
+
+bool FCSharpCompilerRunnable::CreateProc(const FString& InURL, const FString& InParams, int32& OutReturnCode) const
+{
+	auto ProcessHandle = FPlatformProcess::CreateProc(
+		*InURL,
+		*InParams,
+		false,
+		true,
+		true,
+		nullptr,
+		1,
+		nullptr,
+		nullptr,
+		nullptr);
+
+	if (!ProcessHandle.IsValid())
+	{
+		return false;
+	}
+
+	// Polled instead of waited on, so that stopping the compiler does not have to wait for a whole publish
+	while (FPlatformProcess::IsProcRunning(ProcessHandle))
+	{
+		if (bIsStopped)
+		{
+			FPlatformProcess::TerminateProc(ProcessHandle, true);
+
+			FPlatformProcess::CloseProc(ProcessHandle);
+
+			return false;
+		}
+
+		FPlatformProcess::Sleep(0.05f);
+	}
+
+	const auto bIsSucceed = FPlatformProcess::GetProcReturnCode(ProcessHandle, &OutReturnCode);
+
+	FPlatformProcess::CloseProc(ProcessHandle);
+
+	return bIsSucceed;
+}
+
 void FCSharpCompilerRunnable::OnBeginGenerator()
 {
 	bIsGenerating = true;
@@ -336,7 +452,15 @@ void FCSharpCompilerRunnable::OnEndGenerator()
 {
 	bIsGenerating = false;
 
+	// Generation may rewrite the project files, the next compile restores them again
+	bIsRestored = false;
+
 	Tasks.Empty();
 
 	FileChanges.Empty();
+
+	if (Event != nullptr)
+	{
+		Event->Trigger();
+	}
 }
@@ -34,6 +34,10 @@ public:
 private:
 	void Compile();
 
+	void AotCompile() const;
+
+	bool CreateProc(const FString& InURL, const FString& InParams, int32& OutReturnCode) const;
+
 private:
 	void OnBeginGenerator();
 
@@ -58,5 +62,7 @@ private:
 
 	bool bIsStopped;
 
+	bool bIsRestored;
+
 	TSharedPtr<SNotificationItem> NotificationItem;
 };
@@ -45,6 +45,18 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 
 	bool bHasEqualTo = false;
 
+	// Blittable structs are value types, instance calls pass the address of the value instead of a handle
+	const auto bIsBlittable = InClass->GetTypeInfo().IsPrimitive();
+
+	const auto FixedContent = bIsBlittable
+		                          ? FString::Printf(TEXT(
+			                          "fixed (%s* This = &this) "
+		                          ),
+		                                            *ClassContent)
+		                          : FString();
+
+	const auto ObjectContent = bIsBlittable ? FString(TEXT("(nint)This")) : PROPERTY_GARBAGE_COLLECTION_HANDLE;
+
 	if (InClass->GetSubscript().IsSet())
 	{
 		auto Param = InClass->GetSubscript().GetParams()[0];
@@ -66,7 +78,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			"\n"
 			"\t\t\t\t\tvar %s = stackalloc byte[%d];\n"
 			"\n"
-			"\t\t\t\t\t%s.%s(%s, %s, %s);\n"
+			"\t\t\t\t\t%s%s.%s(%s, %s, %s);\n"
 			"\n"
 			"\t\t\t\t\treturn *(%s*)%s;\n"
 			"\t\t\t\t}\n"
@@ -87,11 +99,12 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			                                           ),
 		                                           RETURN_BUFFER_TEXT,
 		                                           Return->GetBufferSize(),
+		                                           *FixedContent,
 		                                           *BINDING_COMBINE_CLASS_IMPLEMENTATION(ClassContent),
 		                                           *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 			                                           ClassContent,
 			                                           InClass->GetSubscript().GetGetImplementationName()),
-		                                           *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+		                                           *ObjectContent,
 		                                           IN_BUFFER_TEXT,
 		                                           RETURN_BUFFER_TEXT,
 		                                           *Return->GetName(),
@@ -109,7 +122,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			"\n"
 			"\t\t\t\t\t*(%s*)(%s + %d) = %s;\n"
 			"\n"
-			"\t\t\t\t\t%s.%s(%s, %s);\n"
+			"\t\t\t\t\t%s%s.%s(%s, %s);\n"
 			"\t\t\t\t}\n"
 			"\t\t\t}\n"
 		),
@@ -137,11 +150,12 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 				                                           "value?.%s ?? nint.Zero"),
 			                                                              *PROPERTY_GARBAGE_COLLECTION_HANDLE
 			                                           ),
+		                                           *FixedContent,
 		                                           *BINDING_COMBINE_CLASS_IMPLEMENTATION(ClassContent),
 		                                           *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 			                                           ClassContent,
 			                                           InClass->GetSubscript().GetSetImplementationName()),
-		                                           *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+		                                           *ObjectContent,
 		                                           IN_BUFFER_TEXT
 		);
 
@@ -191,7 +205,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 				"\t\t\t\t{\n"
 				"\t\t\t\t\tvar %s = stackalloc byte[%d];\n"
 				"\n"
-				"\t\t\t\t\t%s.%s(%s, %s);\n"
+				"\t\t\t\t\t%s%s.%s(%s, %s);\n"
 				"\n"
 				"\t\t\t\t\treturn *(%s*)%s;\n"
 				""
@@ -200,12 +214,13 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			),
 			                                     RETURN_BUFFER_TEXT,
 			                                     Property.GetBufferSize(),
+			                                     Property.IsStatic() ? TEXT("") : *FixedContent,
 			                                     *BINDING_COMBINE_CLASS_IMPLEMENTATION(ClassContent),
 			                                     *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 				                                     ClassContent, (BINDING_PROPERTY_GET + PropertyName)),
 			                                     Property.IsStatic()
 				                                     ? TEXT("nint.Zero")
-				                                     : *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+				                                     : *ObjectContent,
 			                                     RETURN_BUFFER_TEXT,
 			                                     *Property.GetName(),
 			                                     RETURN_BUFFER_TEXT
@@ -223,7 +238,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 				"\n"
 				"\t\t\t\t\t*(%s*)%s = %s;\n"
 				"\n"
-				"\t\t\t\t\t%s.%s(%s, %s);\n"
+				"\t\t\t\t\t%s%s.%s(%s, %s);\n"
 				"\t\t\t\t}\n"
 				"\t\t\t}\n"
 			),
@@ -239,12 +254,13 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 					                                     "value?.%s ?? nint.Zero"),
 				                                                        *PROPERTY_GARBAGE_COLLECTION_HANDLE
 				                                     ),
+			                                     Property.IsStatic() ? TEXT("") : *FixedContent,
 			                                     *BINDING_COMBINE_CLASS_IMPLEMENTATION(ClassContent),
 			                                     *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 				                                     ClassContent, (BINDING_PROPERTY_SET + PropertyName)),
 			                                     Property.IsStatic()
 				                                     ? TEXT("nint.Zero")
-				                                     : *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+				                                     : *ObjectContent,
 			                                     IN_BUFFER_TEXT
 			);
 		}
@@ -533,18 +549,35 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			                                   Function.GetReturn()->GetBufferSize()
 			);
 		}
+		else if (Function.IsConstructor() && bIsBlittable)
+		{
+			ReturnBufferBody = FString::Printf(TEXT(
+				"\t\t\t\tvar %s = stackalloc byte[%d];\n\n"
+			),
+			                                   RETURN_BUFFER_TEXT,
+			                                   InClass->GetTypeInfo().GetBufferSize()
+			);
+		}
 
 		auto FunctionCallBody = FString::Printf(TEXT(
-			"%s.%s(%s, %s, %s, %s);\n"
+			"%s%s.%s(%s, %s, %s, %s);\n"
 		),
+		                                        Function.IsStatic() == true || Function.IsConstructor()
+			                                        ? TEXT("")
+			                                        : *FixedContent,
 		                                        *BINDING_COMBINE_CLASS_IMPLEMENTATION(ClassContent),
 		                                        *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 			                                        ClassContent, Function.GetFunctionImplementationName()),
 		                                        Function.IsStatic() == true
 			                                        ? TEXT("nint.Zero")
 			                                        : Function.IsConstructor()
-			                                        ? TEXT("this")
-			                                        : *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+			                                        ? bIsBlittable
+				                                          ? *FString::Printf(TEXT(
+					                                          "(nint)%s"
+				                                          ),
+				                                                             RETURN_BUFFER_TEXT)
+				                                          : TEXT("this")
+			                                        : *ObjectContent,
 		                                        bHasInBuffer ? IN_BUFFER_TEXT : TEXT("null"),
 		                                        bHasOutBuffer ? OUT_BUFFER_TEXT : TEXT("null"),
 		                                        bHasReturnBuffer ? RETURN_BUFFER_TEXT : TEXT("null")
@@ -561,6 +594,15 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			                                          RETURN_BUFFER_TEXT
 			);
 		}
+		else if (Function.IsConstructor() && bIsBlittable)
+		{
+			FunctionReturnParamBody = FString::Printf(TEXT(
+				"this = *(%s*)%s;"
+			),
+			                                          *ClassContent,
+			                                          RETURN_BUFFER_TEXT
+			);
+		}
 
 		FString FunctionOutParamBody;
 
@@ -617,7 +659,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 			                                                  ),
 				                                                  *FunctionReturnParamBody));
 
-		if (Function.IsConstructor())
+		if (Function.IsConstructor() && !bIsBlittable)
 		{
 			FunctionImplementationBody = FString::Printf(TEXT(
 				"\t\t\t\tif (GetType() == typeof(%s))\n"
@@ -647,7 +689,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 		);
 	}
 
-	if (bHasEqualTo)
+	if (bHasEqualTo && !bIsBlittable)
 	{
 		FunctionContent += FString::Printf(TEXT(
 			"\n\t\tpublic override bool Equals(object Other) => this == Other as %s;\n\n"
@@ -683,7 +725,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 		"%s\n"
 		"namespace %s\n"
 		"{\n"
-		"\tpublic partial class %s%s\n"
+		"\tpublic partial %s %s%s\n"
 		"\t{\n"
 		"%s"
 		"%s"
@@ -697,6 +739,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 	),
 	                               *UsingNameSpaceContent,
 	                               *NameSpaceContent[0],
+	                               bIsBlittable ? TEXT("struct") : TEXT("class"),
 	                               *ClassContent,
 	                               InClass->GetBaseClass().IsEmpty()
 		                               ? (InClass->IsReflectionClass() ? TEXT("") : TEXT(" : IGarbageCollectionHandle"))
@@ -722,7 +765,7 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 
 	const auto FileName = FPaths::Combine(DirectoryName, FileBaseName) + CSHARP_SUFFIX;
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FileName, Content);
+	FGeneratorCore::SaveStringToFile(FileName, Content);
 }
 
 void FBindingClassGenerator::GeneratorImplementation(const FBindingClass* InClass)
@@ -878,7 +921,9 @@ void FBindingClassGenerator::GeneratorImplementation(const FBindingClass* InClas
 		),
 		                                           *BINDING_COMBINE_FUNCTION_IMPLEMENTATION(
 			                                           ClassContent, Function.GetFunctionImplementationName()),
-		                                           Function.IsConstructor() ? *ClassContent : TEXT("nint"),
+		                                           Function.IsConstructor() && !InClass->GetTypeInfo().IsPrimitive()
+			                                           ? *ClassContent
+			                                           : TEXT("nint"),
 		                                           IN_BUFFER_TEXT,
 		                                           OUT_BUFFER_TEXT,
 		                                           RETURN_BUFFER_TEXT
@@ -926,5 +971,5 @@ void FBindingClassGenerator::GeneratorImplementation(const FBindingClass* InClas
 	const auto FileName = FPaths::Combine(DirectoryName,
 	                                      BINDING_COMBINE_CLASS_IMPLEMENTATION(FileBaseName)) + CSHARP_SUFFIX;
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FileName, Content);
+	FGeneratorCore::SaveStringToFile(FileName, Content);
 }
@@ -1,4 +1,5 @@
 #include "FBindingEnumGenerator.h"
+#include "FGeneratorCore.h"
 #include "Binding/FBinding.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "CoreMacro/Macro.h"
@@ -58,5 +59,5 @@ void FBindingEnumGenerator::Generator(const FBindingEnum* InEnum)
 
 	const auto FileName = FPaths::Combine(DirectoryName, ClassContent) + CSHARP_SUFFIX;
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FileName, Content);
+	FGeneratorCore::SaveStringToFile(FileName, Content);
 }
@@ -4,6 +4,7 @@
 #include "FGeneratorCore.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "Engine/UserDefinedEnum.h"
+#include "Async/ParallelFor.h"
 #include "Animation/AnimBlueprintGeneratedClass.h"
 #include "Binding/Class/FBindingClass.h"
 #include "Containers/ArrayBuilder.h"
@@ -15,13 +16,22 @@
 
 void FClassGenerator::Generator()
 {
+	TArray<const UClass*> Classes;
+
 	for (TObjectIterator<UClass> ClassIterator; ClassIterator; ++ClassIterator)
 	{
 		if (!Cast<UBlueprintGeneratedClass>(*ClassIterator))
 		{
-			Generator(*ClassIterator);
+			FGeneratorCore::LoadMetaData(*ClassIterator);
+
+			Classes.Add(*ClassIterator);
 		}
 	}
+
+	ParallelFor(Classes.Num(), [&Classes](const int32 Index)
+	{
+		Generator(Classes[Index]);
+	});
 }
 
 void FClassGenerator::Generator(const UClass* InClass)
@@ -516,6 +526,8 @@ void FClassGenerator::Generator(const UClass* InClass)
 				FunctionOutParamIndex, FunctionRefParamIndex);
 		}
 
+		TArray<int32> FunctionNullableParamIndex;
+
 		for (auto Index = 0; Index < FunctionParams.Num(); ++Index)
 		{
 			if (FunctionOutParamIndex.Contains(Index))
@@ -527,14 +539,24 @@ void FClassGenerator::Generator(const UClass* InClass)
 				FunctionDeclarationBody += TEXT("ref ");
 			}
 
+			const auto FunctionDefaultParam = bGeneratorFunctionDefaultParam
+				                                  ? GetFunctionDefaultParam(Function, FunctionParams[Index])
+				                                  : FString();
+
+			// Blittable structs are value types, a default value is only expressible through a nullable parameter
+			if (!FunctionDefaultParam.IsEmpty() && FGeneratorCore::IsBlittableStructProperty(FunctionParams[Index]))
+			{
+				FunctionNullableParamIndex.Emplace(Index);
+			}
+
 			FunctionDeclarationBody += FString::Printf(TEXT(
-				"%s %s%s%s"),
+				"%s%s %s%s%s"),
 			                                           *FGeneratorCore::GetPropertyType(FunctionParams[Index]),
-			                                           *FUnrealCSharpFunctionLibrary::Encode(FunctionParams[Index]),
-			                                           bGeneratorFunctionDefaultParam
-				                                           ? *GetFunctionDefaultParam(
-					                                           Function, FunctionParams[Index])
+			                                           FunctionNullableParamIndex.Contains(Index)
+				                                           ? TEXT("?")
 				                                           : TEXT(""),
+			                                           *FUnrealCSharpFunctionLibrary::Encode(FunctionParams[Index]),
+			                                           *FunctionDefaultParam,
 			                                           Index == FunctionParams.Num() - 1 ? TEXT("") : TEXT(", ")
 			);
 		}
@@ -594,7 +616,12 @@ void FClassGenerator::Generator(const UClass* InClass)
 						                                : *FString::Printf(TEXT(
 							                                " + %d"),
 						                                                   BufferSize),
-					                                *FGeneratorCore::GetParamName(FunctionParams[Index])
+					                                FunctionNullableParamIndex.Contains(Index)
+						                                ? *FString::Printf(TEXT(
+							                                "%s.Value"),
+						                                                   *FGeneratorCore::GetParamName(
+							                                                   FunctionParams[Index]))
+						                                : *FGeneratorCore::GetParamName(FunctionParams[Index])
 					);
 
 					BufferSize += FGeneratorCore::GetBufferSize(FunctionParams[Index]);
@@ -657,9 +684,13 @@ void FClassGenerator::Generator(const UClass* InClass)
 			);
 		}
 
+		// Static functions are dispatched on the default object bound by the descriptor, without a target handle
+		const auto bIsStaticCall = bIsStatic && !Function->HasAnyFunctionFlags(FUNC_Net);
+
 		auto FunctionCallBody = FString::Printf(TEXT(
-			"FFunctionImplementation.FFunction_%sCall%dImplementation(%s, %s%s%s%s);\n"
+			"FFunctionImplementation.FFunction_%s%sCall%dImplementation(%s%s%s%s%s);\n"
 		),
+		                                        bIsStaticCall ? TEXT("Static") : TEXT(""),
 		                                        *FGeneratorCore::GetFunctionPrefix(FunctionReturnParam),
 		                                        FGeneratorCore::GetFunctionIndex(FunctionReturnParam != nullptr,
 			                                        FunctionParams.Num() - FunctionOutParamIndex.Num() != 0,
@@ -667,11 +698,15 @@ void FClassGenerator::Generator(const UClass* InClass)
 			                                        IsEmpty(),
 			                                        Function->HasAnyFunctionFlags(FUNC_Native),
 			                                        Function->HasAnyFunctionFlags(FUNC_Net)),
-		                                        bIsStatic == true
-			                                        ? *FString::Printf(
-				                                        TEXT("StaticClass().%s"),
-				                                        *PROPERTY_GARBAGE_COLLECTION_HANDLE)
-			                                        : *PROPERTY_GARBAGE_COLLECTION_HANDLE,
+		                                        bIsStaticCall
+			                                        ? TEXT("")
+			                                        : *FString::Printf(
+				                                        TEXT("%s, "),
+				                                        bIsStatic == true
+					                                        ? *FString::Printf(
+						                                        TEXT("StaticClass().%s"),
+						                                        *PROPERTY_GARBAGE_COLLECTION_HANDLE)
+					                                        : *PROPERTY_GARBAGE_COLLECTION_HANDLE),
 		                                        *DummyFunctionName,
 		                                        bHasInBuffer
 			                                        ? *FString::Printf(TEXT(
@@ -870,7 +905,7 @@ void FClassGenerator::Generator(const UClass* InClass)
 	                               *IInterfaceContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InClass), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InClass), Content);
 }
 
 bool FClassGenerator::GeneratorFunctionDefaultParam(const TArray<int32>& InFunctionOutParamIndex,
@@ -1216,7 +1251,7 @@ FString FClassGenerator::GeneratorFunctionDefaultParam(const UFunction* InFuncti
 		return TEXT("");
 	}
 
-	if (FGeneratorCore::IsPrimitiveProperty(InProperty))
+	if (FGeneratorCore::IsPrimitiveProperty(InProperty) && !FGeneratorCore::IsBlittableStructProperty(InProperty))
 	{
 		return TEXT("");
 	}
@@ -1,74 +1,82 @@
 ﻿#include "FCodeAnalysis.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "CoreMacro/Macro.h"
+#include "Log/UnrealCSharpLog.h"
+
+FProcHandle FCodeAnalysis::ProcessHandle;
+
+uint32 FCodeAnalysis::ProcessID = 0u;
+
+void* FCodeAnalysis::InputReadPipe = nullptr;
+
+void* FCodeAnalysis::InputWritePipe = nullptr;
+
+void* FCodeAnalysis::OutputReadPipe = nullptr;
+
+void* FCodeAnalysis::OutputWritePipe = nullptr;
+
+bool FCodeAnalysis::bIsAnalyzed = false;
+
+FString FCodeAnalysis::PendingOutput;
 
 void FCodeAnalysis::CodeAnalysis()
 {
-	Compile();
-
-	Analysis();
+	if (Start())
+	{
+		bIsAnalyzed = Request(GetDirectoryRequest());
+	}
 }
 
 void FCodeAnalysis::Analysis(const FString& InFile)
 {
-	const auto Program = FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCodeAnalysisCSProjPath(),
-	                                     FString::Printf(TEXT(
-		                                     "%s%s"
-	                                     ),
-	                                                     *CODE_ANALYSIS_NAME,
-#if PLATFORM_WINDOWS
-	                                                     TEXT(".exe")
-#else
-	                                                     TEXT("")
-#endif
-	                                     ));
-
-	const auto AnalysisParam = FString::Printf(TEXT(
-		"true \"%s\" \"%s\""
-	),
-	                                           *InFile,
-	                                           *FPaths::ConvertRelativePathToFull(
-		                                           FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath())
-	);
-
-	void* ReadPipe = nullptr;
+	if (Start())
+	{
+		// The outputs are rebuilt from every analysed file, so a fresh process has to see the whole project first
+		if (!bIsAnalyzed)
+		{
+			bIsAnalyzed = Request(GetDirectoryRequest());
+		}
 
-	void* WritePipe = nullptr;
+		Request(FString::Printf(TEXT(
+			"File\t%s"
+		),
+		                        *FPaths::ConvertRelativePathToFull(InFile)
+		));
+	}
+}
 
-	auto OutProcessID = 0u;
+void FCodeAnalysis::Shutdown()
+{
+	if (ProcessHandle.IsValid())
+	{
+		FPlatformProcess::WritePipe(InputWritePipe, TEXT("Exit"));
 
-	FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+		FPlatformProcess::WaitForProc(ProcessHandle);
 
-	auto ProcessHandle = FPlatformProcess::CreateProc(
-		*Program,
-		*AnalysisParam,
-		false,
-		true,
-		true,
-		&OutProcessID,
-		1,
-		nullptr,
-		WritePipe,
-		ReadPipe);
+		FPlatformProcess::CloseProc(ProcessHandle);
+	}
 
-	while (ProcessHandle.IsValid() && FPlatformProcess::IsApplicationRunning(OutProcessID))
+	if (InputReadPipe != nullptr || InputWritePipe != nullptr)
 	{
-		FPlatformProcess::Sleep(0.01f);
+		FPlatformProcess::ClosePipe(InputReadPipe, InputWritePipe);
 	}
 
-	auto ReturnCode = 0;
-
-	if (FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+	if (OutputReadPipe != nullptr || OutputWritePipe != nullptr)
 	{
-		if (ReturnCode == 0)
-		{
-			// @TODO
-		}
-		else
-		{
-			// @TODO
-		}
+		FPlatformProcess::ClosePipe(OutputReadPipe, OutputWritePipe);
 	}
+
+	ProcessHandle.Reset();
+
+	ProcessID = 0u;
+
+	InputReadPipe = InputWritePipe = nullptr;
+
+	OutputReadPipe = OutputWritePipe = nullptr;
+
+	bIsAnalyzed = false;
+
+	PendingOutput.Empty();
 }
 
 void FCodeAnalysis::Compile()
@@ -129,8 +137,17 @@ void FCodeAnalysis::Compile()
 	FPlatformProcess::CloseProc(ProcessHandle);
 }
 
-void FCodeAnalysis::Analysis()
+bool FCodeAnalysis::Start()
 {
+	if (ProcessHandle.IsValid() && FPlatformProcess::IsProcRunning(ProcessHandle))
+	{
+		return true;
+	}
+
+	Shutdown();
+
+	Compile();
+
 	const auto Program = FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCodeAnalysisCSProjPath(),
 	                                     FString::Printf(TEXT(
 		                                     "%s%s"
@@ -143,60 +160,154 @@ void FCodeAnalysis::Analysis()
 #endif
 	                                     ));
 
-	auto AnalysisParam = FString::Printf(TEXT(
-		"false \"%s\" \"%s\""
+	const auto AnalysisParam = FString::Printf(TEXT(
+		"\"%s\""
 	),
-	                                     *FPaths::ConvertRelativePathToFull(
-		                                     FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath()),
-	                                     *FPaths::ConvertRelativePathToFull(
-		                                     FUnrealCSharpFunctionLibrary::GetGameDirectory())
+	                                           *FPaths::ConvertRelativePathToFull(
+		                                           FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath())
 	);
 
-	for (const auto& CustomProjectsDirectory : FUnrealCSharpFunctionLibrary::GetCustomProjectsDirectory())
-	{
-		AnalysisParam += FString::Printf(TEXT(
-			" \"%s\""
-		),
-		                                 *CustomProjectsDirectory
-		);
-	}
+	FPlatformProcess::CreatePipe(InputReadPipe, InputWritePipe, true);
 
-	void* ReadPipe = nullptr;
+	FPlatformProcess::CreatePipe(OutputReadPipe, OutputWritePipe);
 
-	void* WritePipe = nullptr;
-
-	auto OutProcessID = 0u;
-
-	FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
-
-	auto ProcessHandle = FPlatformProcess::CreateProc(
+	ProcessHandle = FPlatformProcess::CreateProc(
 		*Program,
 		*AnalysisParam,
 		false,
 		true,
 		true,
-		&OutProcessID,
+		&ProcessID,
 		1,
 		nullptr,
-		WritePipe,
-		ReadPipe);
+		OutputWritePipe,
+		InputReadPipe);
 
-	while (ProcessHandle.IsValid() && FPlatformProcess::IsApplicationRunning(OutProcessID))
+	if (!ProcessHandle.IsValid())
 	{
-		FPlatformProcess::Sleep(0.01f);
+		UE_LOG(LogUnrealCSharp, Error, TEXT("Failed to start %s"), *Program);
+
+		Shutdown();
+
+		return false;
 	}
 
-	auto ReturnCode = 0;
+	return true;
+}
 
-	if (FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+void FCodeAnalysis::Restart()
+{
+	if (ProcessHandle.IsValid() && FPlatformProcess::IsProcRunning(ProcessHandle))
 	{
-		if (ReturnCode == 0)
+		FPlatformProcess::TerminateProc(ProcessHandle, true);
+	}
+
+	Shutdown();
+
+	Start();
+}
+
+bool FCodeAnalysis::Request(const FString& InRequest)
+{
+	if (!FPlatformProcess::WritePipe(InputWritePipe, InRequest))
+	{
+		UE_LOG(LogUnrealCSharp, Error, TEXT("Code analysis is not running: %s"), *InRequest);
+
+		Restart();
+
+		return false;
+	}
+
+	const auto EndTime = FPlatformTime::Seconds() + RequestTimeout;
+
+	auto SleepTime = 0.f;
+
+	FString Response;
+
+	// Every request is answered with a single Succeeded or Failed line
+	while (!ReadLine(Response) || (Response != TEXT("Succeeded") && Response != TEXT("Failed")))
+	{
+		if (!Response.IsEmpty())
 		{
-			// @TODO
+			UE_LOG(LogUnrealCSharp, Log, TEXT("%s"), *Response);
+
+			Response.Empty();
+
+			continue;
 		}
-		else
+
+		if (!FPlatformProcess::IsProcRunning(ProcessHandle))
 		{
-			// @TODO
+			UE_LOG(LogUnrealCSharp, Error, TEXT("Code analysis exited while handling: %s"), *InRequest);
+
+			Restart();
+
+			return false;
 		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			UE_LOG(LogUnrealCSharp, Error, TEXT("Code analysis timed out after %.0f seconds: %s"),
+			       RequestTimeout, *InRequest);
+
+			Restart();
+
+			return false;
+		}
+
+		// Pipes can only be read without blocking, the wait backs off so that long analyses do not keep a core busy
+		FPlatformProcess::Sleep(SleepTime);
+
+		SleepTime = FMath::Min(FMath::Max(SleepTime * 2.f, 0.0005f), 0.01f);
+	}
+
+	if (Response == TEXT("Succeeded"))
+	{
+		return true;
 	}
+
+	UE_LOG(LogUnrealCSharp, Error, TEXT("Code analysis failed: %s, see %s"), *InRequest,
+	       *FPaths::ConvertRelativePathToFull(FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath(),
+	                                                          TEXT("CodeAnalysis.log"))));
+
+	return false;
+}
+
+bool FCodeAnalysis::ReadLine(FString& OutLine)
+{
+	PendingOutput.Append(FPlatformProcess::ReadPipe(OutputReadPipe));
+
+	auto Index = INDEX_NONE;
+
+	if (!PendingOutput.FindChar(TEXT('\n'), Index))
+	{
+		return false;
+	}
+
+	OutLine = PendingOutput.Left(Index).TrimEnd();
+
+	PendingOutput.RightChopInline(Index + 1);
+
+	return true;
+}
+
+FString FCodeAnalysis::GetDirectoryRequest()
+{
+	auto DirectoryRequest = FString::Printf(TEXT(
+		"Directory\t%s"
+	),
+	                                        *FPaths::ConvertRelativePathToFull(
+		                                        FUnrealCSharpFunctionLibrary::GetGameDirectory())
+	);
+
+	for (const auto& CustomProjectsDirectory : FUnrealCSharpFunctionLibrary::GetCustomProjectsDirectory())
+	{
+		DirectoryRequest += FString::Printf(TEXT(
+			"\t%s"
+		),
+		                                    *CustomProjectsDirectory
+		);
+	}
+
+	return DirectoryRequest;
 }
@@ -7,6 +7,8 @@
 
 TSet<TPair<FString, FString>> FDelegateGenerator::Delegate;
 
+FCriticalSection FDelegateGenerator::CriticalSection;
+
 void FDelegateGenerator::Generator(FProperty* InProperty)
 {
 	if (InProperty == nullptr)
@@ -39,12 +41,18 @@ void FDelegateGenerator::Generator(FDelegateProperty* InDelegateProperty)
 
 	auto ClassContent = FUnrealCSharpFunctionLibrary::GetFullClass(InDelegateProperty);
 
-	if (Delegate.Contains({NameSpaceContent, ClassContent}))
 	{
-		return;
-	}
+		FScopeLock ScopeLock(&CriticalSection);
+
+		bool bIsAlreadyInSet{};
 
-	Delegate.Add({NameSpaceContent, ClassContent});
+		Delegate.Add({NameSpaceContent, ClassContent}, &bIsAlreadyInSet);
+
+		if (bIsAlreadyInSet)
+		{
+			return;
+		}
+	}
 
 	FString SuperClassContent;
 
@@ -431,7 +439,7 @@ void FDelegateGenerator::Generator(FDelegateProperty* InDelegateProperty)
 	                               *DelegateDeclarationContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InDelegateProperty), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InDelegateProperty), Content);
 }
 
 void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelegateProperty)
@@ -449,12 +457,18 @@ void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelega
 
 	auto ClassContent = FUnrealCSharpFunctionLibrary::GetFullClass(InMulticastDelegateProperty);
 
-	if (Delegate.Contains({NameSpaceContent, ClassContent}))
 	{
-		return;
-	}
+		FScopeLock ScopeLock(&CriticalSection);
+
+		bool bIsAlreadyInSet{};
+
+		Delegate.Add({NameSpaceContent, ClassContent}, &bIsAlreadyInSet);
 
-	Delegate.Add({NameSpaceContent, ClassContent});
+		if (bIsAlreadyInSet)
+		{
+			return;
+		}
+	}
 
 	FString SuperClassContent;
 
@@ -792,5 +806,5 @@ void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelega
 	                               *DelegateDeclarationContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InMulticastDelegateProperty), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InMulticastDelegateProperty), Content);
 }
@@ -1,22 +1,34 @@
 ﻿#include "FEnumGenerator.h"
 #include "FGeneratorCore.h"
 #include "Engine/UserDefinedEnum.h"
+#include "Async/ParallelFor.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "CoreMacro/NamespaceMacro.h"
 #include "Dynamic/FDynamicEnumGenerator.h"
 
 TMap<const UEnum*, EEnumUnderlyingType> FEnumGenerator::EnumUnderlyingType;
 
+FCriticalSection FEnumGenerator::CriticalSection;
+
 void FEnumGenerator::Generator()
 {
+	TArray<const UEnum*> Enums;
+
 	for (TObjectIterator<UEnum> EnumIterator; EnumIterator; ++EnumIterator)
 	{
 		if (!Cast<UUserDefinedEnum>(*EnumIterator))
 		{
-			Generator(*EnumIterator);
+			FGeneratorCore::LoadMetaData(*EnumIterator);
+
+			Enums.Add(*EnumIterator);
 		}
 	}
 
+	ParallelFor(Enums.Num(), [&Enums](const int32 Index)
+	{
+		Generator(Enums[Index]);
+	});
+
 	GeneratorCollisionChannel();
 }
 
@@ -106,7 +118,7 @@ void FEnumGenerator::Generator(const UEnum* InEnum)
 	                                     *EnumeratorContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
 }
 
 void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericProperty* InNumericProperty)
@@ -116,11 +128,6 @@ void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericPr
 		return;
 	}
 
-	if (EnumUnderlyingType.Contains(InEnum))
-	{
-		return;
-	}
-
 	auto UnderlyingType = EEnumUnderlyingType::None;
 
 	if (CastField<FInt8Property>(InNumericProperty))
@@ -156,7 +163,12 @@ void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericPr
 		UnderlyingType = EEnumUnderlyingType::UInt64;
 	}
 
-	EnumUnderlyingType.Emplace(InEnum, UnderlyingType);
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!EnumUnderlyingType.Contains(InEnum))
+	{
+		EnumUnderlyingType.Emplace(InEnum, UnderlyingType);
+	}
 }
 
 void FEnumGenerator::GeneratorCollisionChannel()
@@ -227,7 +239,7 @@ void FEnumGenerator::GeneratorCollisionChannel()
 	                                     *EnumeratorContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
 }
 
 FString FEnumGenerator::GetEnumUnderlyingTypeName(const UEnum* InEnum)
@@ -245,9 +257,13 @@ FString FEnumGenerator::GetEnumUnderlyingTypeName(const UEnum* InEnum)
 		{EEnumUnderlyingType::UInt64, TEXT("ulong")}
 	};
 
-	if (const auto FoundEnumUnderlyingType = EnumUnderlyingType.Find(InEnum))
 	{
-		return EnumUnderlyingTypeName[*FoundEnumUnderlyingType];
+		FScopeLock ScopeLock(&CriticalSection);
+
+		if (const auto FoundEnumUnderlyingType = EnumUnderlyingType.Find(InEnum))
+		{
+			return EnumUnderlyingTypeName[*FoundEnumUnderlyingType];
+		}
 	}
 
 	return InEnum->IsA(UUserDefinedEnum::StaticClass()) ? TEXT("byte") : TEXT("long");
@@ -29,6 +29,12 @@ TMap<TWeakObjectPtr<const UObject>, bool> FGeneratorCore::SupportedMap;
 
 TArray<FName> FGeneratorCore::SupportedAssetClassName;
 
+bool FGeneratorCore::bIsFileTracking;
+
+TSet<FString> FGeneratorCore::TrackedFiles;
+
+FCriticalSection FGeneratorCore::CriticalSection;
+
 FString FGeneratorCore::GetPathNameAttribute(const UField* InField)
 {
 	if (InField == nullptr)
@@ -441,6 +447,11 @@ FString FGeneratorCore::GetBufferCast(FProperty* Property)
 
 	if (CastField<FDoubleProperty>(Property)) return TEXT("double");
 
+	if (IsBlittableStructProperty(Property))
+	{
+		return GetPropertyType(Property);
+	}
+
 	return TEXT("nint");
 }
 
@@ -562,6 +573,16 @@ bool FGeneratorCore::IsPrimitiveProperty(FProperty* Property)
 		return true;
 	}
 
+	return IsBlittableStructProperty(Property);
+}
+
+bool FGeneratorCore::IsBlittableStructProperty(FProperty* Property)
+{
+	if (const auto StructProperty = CastField<FStructProperty>(Property))
+	{
+		return FUnrealCSharpFunctionLibrary::IsBlittableStruct(StructProperty->Struct);
+	}
+
 	return false;
 }
 
@@ -754,14 +775,14 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 {
 	if (bIsGenerateAllModules && InClass->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InClass))
+	if (bool bIsSupported; FindSupported(InClass, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupportedModule(FUnrealCSharpFunctionLibrary::GetClassNameSpace(InClass)))
 	{
-		SupportedMap.Add(InClass, false);
+		AddSupported(InClass, false);
 
 		return false;
 	}
@@ -770,7 +791,7 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 	{
 		if (!IsSupported(SuperClass))
 		{
-			SupportedMap.Add(InClass, false);
+			AddSupported(InClass, false);
 
 			return false;
 		}
@@ -780,13 +801,13 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 	{
 		if (!IsSupported(Interface.Class))
 		{
-			SupportedMap.Add(InClass, false);
+			AddSupported(InClass, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InClass, true);
+	AddSupported(InClass, true);
 
 	return true;
 }
@@ -795,9 +816,9 @@ bool FGeneratorCore::IsSupported(const UFunction* InFunction)
 {
 	if (bIsGenerateAllModules && InFunction->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InFunction))
+	if (bool bIsSupported; FindSupported(InFunction, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	for (TFieldIterator<FProperty> ParamIterator(InFunction); ParamIterator && (ParamIterator->PropertyFlags
@@ -805,13 +826,13 @@ bool FGeneratorCore::IsSupported(const UFunction* InFunction)
 	{
 		if (!IsSupported(*ParamIterator))
 		{
-			SupportedMap.Add(InFunction, false);
+			AddSupported(InFunction, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InFunction, true);
+	AddSupported(InFunction, true);
 
 	return true;
 }
@@ -820,14 +841,14 @@ bool FGeneratorCore::IsSupported(const UStruct* InStruct)
 {
 	if (bIsGenerateAllModules && InStruct->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InStruct))
+	if (bool bIsSupported; FindSupported(InStruct, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupportedModule(FUnrealCSharpFunctionLibrary::GetClassNameSpace(InStruct)))
 	{
-		SupportedMap.Add(InStruct, false);
+		AddSupported(InStruct, false);
 
 		return false;
 	}
@@ -836,13 +857,13 @@ bool FGeneratorCore::IsSupported(const UStruct* InStruct)
 	{
 		if (!IsSupported(SuperStruct))
 		{
-			SupportedMap.Add(InStruct, false);
+			AddSupported(InStruct, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InStruct, true);
+	AddSupported(InStruct, true);
 
 	return true;
 }
@@ -851,19 +872,19 @@ bool FGeneratorCore::IsSupported(const UEnum* InEnum)
 {
 	if (bIsGenerateAllModules && InEnum->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InEnum))
+	if (bool bIsSupported; FindSupported(InEnum, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupportedModule(FUnrealCSharpFunctionLibrary::GetClassNameSpace(InEnum)))
 	{
-		SupportedMap.Add(InEnum, false);
+		AddSupported(InEnum, false);
 
 		return false;
 	}
 
-	SupportedMap.Add(InEnum, true);
+	AddSupported(InEnum, true);
 
 	return true;
 }
@@ -882,6 +903,27 @@ bool FGeneratorCore::IsSupportedModule(const FString& InModule)
 	return SupportedModule.Contains(InModule);
 }
 
+bool FGeneratorCore::FindSupported(const UObject* InObject, bool& OutSupported)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (const auto FoundSupported = SupportedMap.Find(InObject))
+	{
+		OutSupported = *FoundSupported;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FGeneratorCore::AddSupported(const UObject* InObject, const bool bIsSupported)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	SupportedMap.Add(InObject, bIsSupported);
+}
+
 const TArray<FName>& FGeneratorCore::GetSupportedAssetPath()
 {
 	return SupportedAssetPath;
@@ -948,6 +990,50 @@ void FGeneratorCore::BeginGenerator()
 		*FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath(),
 		*OVERRIDE_FUNCTION
 	));
+
+	// The module lists are filled on first use, which must not happen on the generator workers
+	FUnrealCSharpFunctionLibrary::GetEngineModuleList();
+
+	FUnrealCSharpFunctionLibrary::GetProjectModuleList();
+}
+
+void FGeneratorCore::LoadMetaData(const UStruct* InStruct)
+{
+	LoadMetaData(static_cast<const UField*>(InStruct));
+
+	const auto LoadPropertyMetaData = [](const UStruct* InOwner)
+	{
+		for (TFieldIterator<FProperty> It(InOwner, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			if (const auto DelegateProperty = CastField<FDelegateProperty>(*It))
+			{
+				LoadMetaData(static_cast<const UField*>(DelegateProperty->SignatureFunction));
+			}
+			else if (const auto MulticastDelegateProperty = CastField<FMulticastDelegateProperty>(*It))
+			{
+				LoadMetaData(static_cast<const UField*>(MulticastDelegateProperty->SignatureFunction));
+			}
+		}
+	};
+
+	LoadPropertyMetaData(InStruct);
+
+	if (const auto Class = Cast<UClass>(InStruct))
+	{
+		for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			LoadPropertyMetaData(*It);
+		}
+	}
+}
+
+void FGeneratorCore::LoadMetaData(const UField* InField)
+{
+	// Package metadata is created and loaded on first access, which is not safe from the generator workers
+	if (InField != nullptr)
+	{
+		InField->GetOutermost()->GetMetaData();
+	}
 }
 
 void FGeneratorCore::EndGenerator()
@@ -970,3 +1056,71 @@ void FGeneratorCore::EndGenerator()
 
 	FEnumGenerator::EnumUnderlyingType.Empty();
 }
+
+void FGeneratorCore::BeginFileTracking()
+{
+	bIsFileTracking = true;
+
+	TrackedFiles.Empty();
+}
+
+void FGeneratorCore::EndFileTracking()
+{
+	bIsFileTracking = false;
+
+	TArray<FString> Directories;
+
+	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+		UUnrealCSharpEditorSetting>(); UnrealCSharpEditorSetting != nullptr &&
+		UnrealCSharpEditorSetting->EnableDeleteProxyDirectory())
+	{
+		Directories.Add(FUnrealCSharpFunctionLibrary::GetUEProxyDirectory());
+
+		Directories.Add(FUnrealCSharpFunctionLibrary::GetGameProxyDirectory());
+	}
+	else
+	{
+		Directories.Add(FPaths::Combine(FUnrealCSharpFunctionLibrary::GetUEProxyDirectory(),
+		                                FUnrealCSharpFunctionLibrary::GetBindingDirectory()));
+
+		Directories.Add(FPaths::Combine(FUnrealCSharpFunctionLibrary::GetGameProxyDirectory(),
+		                                FUnrealCSharpFunctionLibrary::GetBindingDirectory()));
+	}
+
+	auto& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Only files that were not generated this time are removed, so untouched outputs keep their timestamps
+	for (const auto& Directory : Directories)
+	{
+		if (!PlatformFile.DirectoryExists(*Directory))
+		{
+			continue;
+		}
+
+		TArray<FString> Files;
+
+		IFileManager::Get().FindFilesRecursive(Files, *Directory, *(TEXT("*") + CSHARP_SUFFIX), true, false);
+
+		for (const auto& File : Files)
+		{
+			if (!TrackedFiles.Contains(FPaths::ConvertRelativePathToFull(File)))
+			{
+				PlatformFile.DeleteFile(*File);
+			}
+		}
+	}
+
+	TrackedFiles.Empty();
+}
+
+bool FGeneratorCore::SaveStringToFile(const FString& InFileName, const FString& InString)
+{
+	if (bIsFileTracking)
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		TrackedFiles.Add(FPaths::ConvertRelativePathToFull(InFileName));
+	}
+
+	return FUnrealCSharpFunctionLibrary::SaveStringToFile(InFileName, InString);
+}
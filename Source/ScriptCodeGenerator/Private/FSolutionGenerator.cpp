@@ -112,9 +112,7 @@ void FSolutionGenerator::CopyTemplate(const FString& Dest, const FString& Src,
 		Function(Result);
 	}
 
-	auto& FileManager = IFileManager::Get();
-
-	FFileHelper::SaveStringToFile(Result, *Dest, FFileHelper::EEncodingOptions::ForceUTF8, &FileManager);
+	FUnrealCSharpFunctionLibrary::SaveStringToFile(Dest, Result);
 }
 
 void FSolutionGenerator::ReplacePluginBaseDir(FString& OutResult)
@@ -3,6 +3,7 @@
 #include "FGeneratorCore.h"
 #include "Binding/Class/FBindingClass.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Async/ParallelFor.h"
 #include "Kismet2/StructureEditorUtils.h"
 #include "Animation/AnimBlueprintGeneratedClass.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
@@ -13,13 +14,22 @@
 
 void FStructGenerator::Generator()
 {
+	TArray<const UScriptStruct*> ScriptStructs;
+
 	for (TObjectIterator<UScriptStruct> ScriptStructIterator; ScriptStructIterator; ++ScriptStructIterator)
 	{
 		if (!Cast<UUserDefinedStruct>(*ScriptStructIterator))
 		{
-			Generator(*ScriptStructIterator);
+			FGeneratorCore::LoadMetaData(*ScriptStructIterator);
+
+			ScriptStructs.Add(*ScriptStructIterator);
 		}
 	}
+
+	ParallelFor(ScriptStructs.Num(), [&ScriptStructs](const int32 Index)
+	{
+		Generator(ScriptStructs[Index]);
+	});
 }
 
 void FStructGenerator::Generator(const UScriptStruct* InScriptStruct)
@@ -59,6 +69,13 @@ void FStructGenerator::Generator(const UScriptStruct* InScriptStruct)
 		return;
 	}
 
+	if (FUnrealCSharpFunctionLibrary::IsBlittableStruct(InScriptStruct))
+	{
+		GeneratorBlittableStruct(InScriptStruct);
+
+		return;
+	}
+
 	auto UserDefinedStruct = Cast<UUserDefinedStruct>(InScriptStruct);
 
 	FString UsingNameSpaceContent;
@@ -336,5 +353,127 @@ void FStructGenerator::Generator(const UScriptStruct* InScriptStruct)
 	                               *GCHandleContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InScriptStruct), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InScriptStruct), Content);
+}
+
+void FStructGenerator::GeneratorBlittableStruct(const UScriptStruct* InScriptStruct)
+{
+	FString UsingNameSpaceContent;
+
+	auto NameSpaceContent = FUnrealCSharpFunctionLibrary::GetClassNameSpace(InScriptStruct);
+
+	auto PathNameAttributeContent = FGeneratorCore::GetPathNameAttribute(InScriptStruct);
+
+	auto ClassContent = FUnrealCSharpFunctionLibrary::GetFullClass(InScriptStruct);
+
+	FString FieldContent;
+
+	FString EqualToContent;
+
+	FString HashCodeContent;
+
+	TSet<FString> UsingNameSpaces{
+		TEXT("System"),
+		TEXT("System.Runtime.InteropServices"),
+		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT),
+		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_LIBRARY),
+		FUnrealCSharpFunctionLibrary::GetClassNameSpace(UScriptStruct::StaticClass())
+	};
+
+	auto StaticStructContent = FString::Printf(TEXT(
+		"\t\tpublic static UScriptStruct StaticStruct()\n"
+		"\t\t{\n"
+		"\t\t\treturn StaticStructSingleton \?\?= UStructImplementation.UStruct_StaticStructImplementation(\"%s\");\n"
+		"\t\t}\n\n"
+		"\t\tprivate static UScriptStruct StaticStructSingleton { get; set; }\n"
+	),
+	                                           *PathNameAttributeContent
+	);
+
+	// The managed layout mirrors the native one, so values are copied across the boundary as they are
+	for (TFieldIterator<FProperty> PropertyIterator(InScriptStruct, EFieldIteratorFlags::ExcludeSuper,
+	                                                EFieldIteratorFlags::ExcludeDeprecated); PropertyIterator; ++
+	     PropertyIterator)
+	{
+		auto PropertyName = FUnrealCSharpFunctionLibrary::Encode(*PropertyIterator);
+
+		UsingNameSpaces.Append(FGeneratorCore::GetPropertyTypeNameSpace(*PropertyIterator));
+
+		FieldContent += FString::Printf(TEXT(
+			"%s\t\t[FieldOffset(%d)] public %s %s;\n"
+		),
+		                                FieldContent.IsEmpty() ? TEXT("") : TEXT("\n"),
+		                                PropertyIterator->GetOffset_ForInternal(),
+		                                *FGeneratorCore::GetPropertyType(*PropertyIterator),
+		                                *PropertyName
+		);
+
+		EqualToContent += FString::Printf(TEXT(
+			"%sA.%s == B.%s"
+		),
+		                                  EqualToContent.IsEmpty() ? TEXT("") : TEXT(" && "),
+		                                  *PropertyName,
+		                                  *PropertyName
+		);
+
+		HashCodeContent += FString::Printf(TEXT(
+			"%s%s"
+		),
+		                                   HashCodeContent.IsEmpty() ? TEXT("") : TEXT(", "),
+		                                   *PropertyName
+		);
+	}
+
+	auto IdenticalContent = FString::Printf(TEXT(
+		"\t\tpublic static bool operator ==(%s A, %s B) => %s;\n\n"
+		"\t\tpublic static bool operator !=(%s A, %s B) => !(A == B);\n\n"
+		"\t\tpublic override bool Equals(object Other) => Other is %s Value && this == Value;\n\n"
+		"\t\tpublic override int GetHashCode() => HashCode.Combine(%s);\n"
+	),
+	                                        *ClassContent,
+	                                        *ClassContent,
+	                                        *EqualToContent,
+	                                        *ClassContent,
+	                                        *ClassContent,
+	                                        *ClassContent,
+	                                        *HashCodeContent
+	);
+
+	UsingNameSpaces.Remove(NameSpaceContent);
+
+	UsingNameSpaces.Remove(TEXT(""));
+
+	for (auto UsingNameSpace : UsingNameSpaces)
+	{
+		UsingNameSpaceContent += FString::Printf(TEXT(
+			"using %s;\n"
+		),
+		                                         *UsingNameSpace);
+	}
+
+	auto Content = FString::Printf(TEXT(
+		"%s\n"
+		"namespace %s\n"
+		"{\n"
+		"\t[PathName(\"%s\")]\n"
+		"\t[StructLayout(LayoutKind.Explicit, Size = %d)]\n"
+		"\tpublic partial struct %s : IStaticStruct\n"
+		"\t{\n"
+		"%s\n"
+		"%s\n"
+		"%s"
+		"\t}\n"
+		"}"
+	),
+	                               *UsingNameSpaceContent,
+	                               *NameSpaceContent,
+	                               *PathNameAttributeContent,
+	                               InScriptStruct->GetStructureSize(),
+	                               *ClassContent,
+	                               *StaticStructContent,
+	                               *IdenticalContent,
+	                               *FieldContent
+	);
+
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InScriptStruct), Content);
 }
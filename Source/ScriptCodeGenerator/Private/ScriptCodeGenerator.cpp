@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ScriptCodeGenerator.h"
+#include "FCodeAnalysis.h"
 
 #define LOCTEXT_NAMESPACE "FScriptCodeGeneratorModule"
 
@@ -13,6 +14,8 @@ void FScriptCodeGeneratorModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FCodeAnalysis::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
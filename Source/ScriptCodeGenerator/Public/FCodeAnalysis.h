@@ -1,5 +1,9 @@
 ﻿#pragma once
 
+/*
+ * CodeAnalysis runs as one resident process for the whole editor session, it keeps the parsed files
+ * and only analyses again the ones whose content changed.
+ */
 class FCodeAnalysis
 {
 public:
@@ -7,8 +11,39 @@ public:
 
 	static SCRIPTCODEGENERATOR_API void Analysis(const FString& InFile);
 
+	static SCRIPTCODEGENERATOR_API void Shutdown();
+
 private:
 	static void Compile();
 
-	static void Analysis();
+	static bool Start();
+
+	static void Restart();
+
+	static bool Request(const FString& InRequest);
+
+	static bool ReadLine(FString& OutLine);
+
+	static FString GetDirectoryRequest();
+
+private:
+	static FProcHandle ProcessHandle;
+
+	static uint32 ProcessID;
+
+	static void* InputReadPipe;
+
+	static void* InputWritePipe;
+
+	static void* OutputReadPipe;
+
+	static void* OutputWritePipe;
+
+	static bool bIsAnalyzed;
+
+	// Output read past the end of a response, kept for the next one
+	static FString PendingOutput;
+
+	// A request that takes longer than this is treated as hung, the process is killed and started again
+	static constexpr auto RequestTimeout = 300.0;
 };
@@ -15,4 +15,6 @@ private:
 	static void Generator(FMulticastDelegateProperty* InMulticastDelegateProperty);
 
 	static TSet<TPair<FString, FString>> Delegate;
+
+	static FCriticalSection CriticalSection;
 };
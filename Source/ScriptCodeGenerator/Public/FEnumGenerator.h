@@ -33,4 +33,6 @@ private:
 	friend class FGeneratorCore;
 
 	static TMap<const UEnum*, EEnumUnderlyingType> EnumUnderlyingType;
+
+	static FCriticalSection CriticalSection;
 };
@@ -21,6 +21,8 @@ public:
 
 	static bool IsPrimitiveProperty(FProperty* Property);
 
+	static bool IsBlittableStructProperty(FProperty* Property);
+
 	static FString GetParamName(FProperty* Property);
 
 	static FString GetFunctionPrefix(FProperty* Property);
@@ -54,6 +56,21 @@ public:
 
 	static SCRIPTCODEGENERATOR_API void EndGenerator();
 
+	static SCRIPTCODEGENERATOR_API void BeginFileTracking();
+
+	static SCRIPTCODEGENERATOR_API void EndFileTracking();
+
+	static bool SaveStringToFile(const FString& InFileName, const FString& InString);
+
+	static void LoadMetaData(const UStruct* InStruct);
+
+	static void LoadMetaData(const UField* InField);
+
+private:
+	static bool FindSupported(const UObject* InObject, bool& OutSupported);
+
+	static void AddSupported(const UObject* InObject, bool bIsSupported);
+
 private:
 	static TMap<FString, TArray<FString>> OverrideFunctionsMap;
 
@@ -70,6 +87,12 @@ private:
 	static TMap<TWeakObjectPtr<const UObject>, bool> SupportedMap;
 
 	static TArray<FName> SupportedAssetClassName;
+
+	static bool bIsFileTracking;
+
+	static TSet<FString> TrackedFiles;
+
+	static FCriticalSection CriticalSection;
 };
 
 #include "FGeneratorCore.inl"
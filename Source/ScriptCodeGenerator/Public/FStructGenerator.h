@@ -8,4 +8,7 @@ public:
 	static SCRIPTCODEGENERATOR_API void Generator();
 
 	static void Generator(const UScriptStruct* InScriptStruct);
+
+private:
+	static void GeneratorBlittableStruct(const UScriptStruct* InScriptStruct);
 };
@@ -0,0 +1,558 @@
+﻿#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Environment/FCSharpEnvironment.h"
+#include "Binding/FBinding.h"
+#include "CoreMacro/BufferMacro.h"
+#include "Dynamic/FDynamicClassGenerator.h"
+#include "Reflection/Function/CSharpFunction.h"
+#include "Reflection/Function/FUnrealFunctionDescriptor.h"
+#include "Reflection/Container/FArrayHelper.h"
+#include "Reflection/Container/FMapHelper.h"
+#include "Reflection/Container/FSetHelper.h"
+#include "Reflection/Delegate/FMulticastDelegateHelper.h"
+#include "Components/StaticMeshComponent.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/*
+	 * Native cases run the code an internal call reaches once the handle and the hash have been resolved.
+	 * Managed cases go through the registered internal calls or into managed code and also report managed bytes,
+	 * read from the allocation counter of the game thread so that only work done by a case is counted.
+	 */
+	class FInteropBenchmark
+	{
+	public:
+		explicit FInteropBenchmark(FAutomationTestBase* InTest):
+			Test(InTest),
+			bIsManaged(FCSharpEnvironment::GetEnvironment().GetDomain() != nullptr),
+			AllocatedBytesOverhead(0)
+		{
+			if (bIsManaged)
+			{
+				const auto AllocatedBytes = GetAllocatedBytes();
+
+				AllocatedBytesOverhead = GetAllocatedBytes() - AllocatedBytes;
+			}
+		}
+
+	public:
+		bool IsManaged() const
+		{
+			return bIsManaged;
+		}
+
+		template <typename Function>
+		void RunNative(const FString& InName, const int32 InSize, const int32 InIterations, Function&& InFunction)
+		{
+			WarmUp(InIterations, InFunction);
+
+			const auto NanosecondsPerOperation = Measure(InIterations, InFunction);
+
+			Results.Add(FString::Printf(TEXT(
+				"\t\t{\"name\": \"%s\", \"size\": %d, \"iterations\": %d, \"ns_per_op\": %.2f}"),
+			                            *InName, InSize, InIterations, NanosecondsPerOperation));
+
+			Test->AddInfo(FString::Printf(TEXT("%s(%d): %.2f ns/op"),
+			                              *InName, InSize, NanosecondsPerOperation));
+		}
+
+		template <typename Function>
+		void RunManaged(const FString& InName, const int32 InSize, const int32 InIterations, Function&& InFunction)
+		{
+			WarmUp(InIterations, InFunction);
+
+			const auto BeginAllocatedBytes = GetAllocatedBytes();
+
+			const auto NanosecondsPerOperation = Measure(InIterations, InFunction);
+
+			const auto EndAllocatedBytes = GetAllocatedBytes();
+
+			const auto ManagedBytes = EndAllocatedBytes - BeginAllocatedBytes - AllocatedBytesOverhead;
+
+			const auto ManagedBytesPerOperation = ManagedBytes > 0
+				                                      ? static_cast<double>(ManagedBytes) / InIterations
+				                                      : 0.0;
+
+			Results.Add(FString::Printf(TEXT(
+				"\t\t{\"name\": \"%s\", \"size\": %d, \"iterations\": %d, \"ns_per_op\": %.2f, \"managed_bytes_per_op\": %.2f}"),
+			                            *InName, InSize, InIterations, NanosecondsPerOperation,
+			                            ManagedBytesPerOperation));
+
+			Test->AddInfo(FString::Printf(TEXT("%s(%d): %.2f ns/op, %.2f managed bytes/op"),
+			                              *InName, InSize, NanosecondsPerOperation, ManagedBytesPerOperation));
+		}
+
+		void Skip(const FString& InName, const FString& InReason) const
+		{
+			Test->AddWarning(FString::Printf(TEXT("%s skipped: %s"), *InName, *InReason));
+		}
+
+		bool Save() const
+		{
+			const auto FileName = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealCSharp"),
+			                                      TEXT("InteropBenchmark.json"));
+
+			const auto Content = FString::Printf(TEXT("{\n\t\"managed\": %s,\n\t\"results\": [\n%s\n\t]\n}\n"),
+			                                     bIsManaged ? TEXT("true") : TEXT("false"),
+			                                     *FString::Join(Results, TEXT(",\n")));
+
+			if (!FFileHelper::SaveStringToFile(Content, *FileName, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				return false;
+			}
+
+			Test->AddInfo(FString::Printf(TEXT("Results written to %s"), *FileName));
+
+			return true;
+		}
+
+	private:
+		template <typename Function>
+		static void WarmUp(const int32 InIterations, Function& InFunction)
+		{
+			for (auto Index = 0; Index < FMath::Max(InIterations / 10, 1); ++Index)
+			{
+				InFunction(Index);
+			}
+		}
+
+		template <typename Function>
+		static double Measure(const int32 InIterations, Function& InFunction)
+		{
+			const auto BeginCycles = FPlatformTime::Cycles64();
+
+			for (auto Index = 0; Index < InIterations; ++Index)
+			{
+				InFunction(Index);
+			}
+
+			const auto EndCycles = FPlatformTime::Cycles64();
+
+			return FPlatformTime::ToMilliseconds64(EndCycles - BeginCycles) * 1000000.0 / InIterations;
+		}
+
+		int64 GetAllocatedBytes() const
+		{
+			return bIsManaged ? FMonoDomain::GC_Get_Allocated_Bytes_For_Current_Thread() : 0;
+		}
+
+	private:
+		FAutomationTestBase* Test;
+
+		bool bIsManaged;
+
+		// Reading the counter itself is subtracted from every managed case
+		int64 AllocatedBytesOverhead;
+
+		TArray<FString> Results;
+	};
+
+	typedef void (*FGetPropertyImplementation)(FGarbageCollectionHandle, uint32, RETURN_BUFFER_SIGNATURE);
+
+	typedef void (*FSetPropertyImplementation)(FGarbageCollectionHandle, uint32, IN_BUFFER_SIGNATURE);
+
+	constexpr auto CallIterations = 100000;
+
+	constexpr auto CompoundIterations = 10000;
+
+	constexpr auto ContainerSize = 1024;
+
+	constexpr auto ContainerIterations = 100000;
+
+	// Dynamic class of the game project, see RunCallCSharpBenchmark
+	constexpr auto FixtureClassName = TEXT("InteropBenchmarkFixture");
+
+	constexpr auto FixtureFunctionName = TEXT("Add");
+
+	const void* FindInternalCall(const FString& InImplementationName)
+	{
+		const auto MethodName = FString::Printf(TEXT("::%s"), *InImplementationName);
+
+		for (const auto& Class : FBinding::Get().Register().GetClasses())
+		{
+			for (const auto& Method : Class->GetMethods())
+			{
+				if (Method.GetMethod().EndsWith(MethodName))
+				{
+					return Method.GetFunction();
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	void RunFunctionBenchmark(FInteropBenchmark& InBenchmark)
+	{
+		const auto AddFunction = UKismetMathLibrary::StaticClass()->FindFunctionByName(
+			GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Add_IntInt));
+
+		const auto ConvFunction = UKismetStringLibrary::StaticClass()->FindFunctionByName(
+			GET_FUNCTION_NAME_CHECKED(UKismetStringLibrary, Conv_IntToString));
+
+		if (AddFunction == nullptr || ConvFunction == nullptr)
+		{
+			InBenchmark.Skip(TEXT("UnrealFunction"), TEXT("kismet library functions not found"));
+
+			return;
+		}
+
+		const FUnrealFunctionDescriptor AddFunctionDescriptor(AddFunction);
+
+		int32 InBuffer[2]{};
+
+		int32 ReturnBuffer{};
+
+		InBenchmark.RunNative(TEXT("UnrealFunction.Call3.Primitive"), 1, CallIterations, [&](const int32 Index)
+		{
+			InBuffer[0] = Index;
+
+			InBuffer[1] = 1;
+
+			AddFunctionDescriptor.Call3<EFunctionReturnType::Primitive>(AddFunctionDescriptor.GetDefaultObject(),
+			                                                            reinterpret_cast<uint8*>(InBuffer),
+			                                                            reinterpret_cast<uint8*>(&ReturnBuffer));
+		});
+
+		InBenchmark.RunNative(TEXT("UnrealFunction.Call11.Primitive"), 1, CallIterations, [&](const int32 Index)
+		{
+			InBuffer[0] = Index;
+
+			InBuffer[1] = 1;
+
+			AddFunctionDescriptor.Call11<EFunctionReturnType::Primitive>(AddFunctionDescriptor.GetDefaultObject(),
+			                                                             reinterpret_cast<uint8*>(InBuffer),
+			                                                             reinterpret_cast<uint8*>(&ReturnBuffer));
+		});
+
+		if (!InBenchmark.IsManaged())
+		{
+			InBenchmark.Skip(TEXT("UnrealFunction.Call11.Compound"), TEXT("domain is not active"));
+
+			return;
+		}
+
+		const FUnrealFunctionDescriptor ConvFunctionDescriptor(ConvFunction);
+
+		void* CompoundReturnBuffer{};
+
+		InBenchmark.RunManaged(TEXT("UnrealFunction.Call11.Compound"), 1, CompoundIterations, [&](const int32 Index)
+		{
+			InBuffer[0] = Index;
+
+			ConvFunctionDescriptor.Call11<EFunctionReturnType::Compound>(ConvFunctionDescriptor.GetDefaultObject(),
+			                                                             reinterpret_cast<uint8*>(InBuffer),
+			                                                             reinterpret_cast<uint8*>(
+				                                                             &CompoundReturnBuffer));
+		});
+	}
+
+	/*
+	 * Needs a dynamic class in the game project which overrides a function in managed code, such as
+	 * [UClass] public partial class UInteropBenchmarkFixture : UObject { [UFunction] public int Add(int A, int B) }
+	 */
+	void RunCallCSharpBenchmark(FInteropBenchmark& InBenchmark)
+	{
+		if (!InBenchmark.IsManaged())
+		{
+			InBenchmark.Skip(TEXT("CallCSharp"), TEXT("domain is not active"));
+
+			return;
+		}
+
+		UClass* FixtureClass{};
+
+		for (const auto DynamicClass : FDynamicClassGenerator::GetDynamicClasses())
+		{
+			if (DynamicClass != nullptr && DynamicClass->GetName() == FixtureClassName)
+			{
+				FixtureClass = DynamicClass;
+
+				break;
+			}
+		}
+
+		const auto FixtureFunction = FixtureClass != nullptr
+			                             ? FixtureClass->FindFunctionByName(FixtureFunctionName)
+			                             : nullptr;
+
+		if (FixtureFunction == nullptr || FixtureFunction->GetNativeFunc() != &UCSharpFunction::execCallCSharp)
+		{
+			InBenchmark.Skip(TEXT("CallCSharp"), FString::Printf(TEXT(
+				                 "dynamic class %s with a managed %s function not found in the game project"),
+			                                                     FixtureClassName, FixtureFunctionName));
+
+			return;
+		}
+
+		TArray<FIntProperty*> InProperties;
+
+		for (TFieldIterator<FProperty> It(FixtureFunction); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			if (!It->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				if (const auto IntProperty = CastField<FIntProperty>(*It))
+				{
+					InProperties.Add(IntProperty);
+				}
+			}
+		}
+
+		if (InProperties.Num() != 2 || FixtureFunction->NumParms != 3)
+		{
+			InBenchmark.Skip(TEXT("CallCSharp"), FString::Printf(TEXT("%s must take two ints and return an int"),
+			                                                     FixtureFunctionName));
+
+			return;
+		}
+
+		const auto Fixture = NewObject<UObject>(GetTransientPackage(), FixtureClass, NAME_None, RF_Transient);
+
+		Fixture->AddToRoot();
+
+		TArray<uint8> Params;
+
+		Params.SetNumZeroed(FixtureFunction->ParmsSize);
+
+		InBenchmark.RunManaged(TEXT("CallCSharp.ProcessEvent.Primitive"), 1, CallIterations, [&](const int32 Index)
+		{
+			InProperties[0]->SetPropertyValue_InContainer(Params.GetData(), Index);
+
+			InProperties[1]->SetPropertyValue_InContainer(Params.GetData(), 1);
+
+			Fixture->ProcessEvent(FixtureFunction, Params.GetData());
+		});
+
+		Fixture->RemoveFromRoot();
+	}
+
+	void RunPropertyBenchmark(FInteropBenchmark& InBenchmark, UObject* InObject)
+	{
+		if (!InBenchmark.IsManaged())
+		{
+			InBenchmark.Skip(TEXT("Property"), TEXT("domain is not active"));
+
+			return;
+		}
+
+		const auto GetObjectProperty = reinterpret_cast<FGetPropertyImplementation>(
+			FindInternalCall(TEXT("FProperty_GetObjectPropertyImplementation")));
+
+		const auto SetObjectProperty = reinterpret_cast<FSetPropertyImplementation>(
+			FindInternalCall(TEXT("FProperty_SetObjectPropertyImplementation")));
+
+		if (GetObjectProperty == nullptr || SetObjectProperty == nullptr)
+		{
+			InBenchmark.Skip(TEXT("Property"), TEXT("property internal calls not registered"));
+
+			return;
+		}
+
+		if (FCSharpEnvironment::GetEnvironment().Bind(InObject) == nullptr)
+		{
+			InBenchmark.Skip(TEXT("Property"), TEXT("component could not be bound"));
+
+			return;
+		}
+
+		const auto PriorityProperty = InObject->GetClass()->FindPropertyByName(TEXT("TranslucencySortPriority"));
+
+		const auto LocationProperty = InObject->GetClass()->FindPropertyByName(TEXT("RelativeLocation"));
+
+		if (PriorityProperty == nullptr || LocationProperty == nullptr)
+		{
+			InBenchmark.Skip(TEXT("Property"), TEXT("component properties not found"));
+
+			return;
+		}
+
+		// Hashes are the ones the generated code passes, resolved from the bound classes on first use
+		const auto PriorityPropertyHash = GetTypeHash(PriorityProperty);
+
+		const auto LocationPropertyHash = GetTypeHash(LocationProperty);
+
+		if (FCSharpEnvironment::GetEnvironment().GetOrAddPropertyDescriptor(PriorityPropertyHash) == nullptr ||
+			FCSharpEnvironment::GetEnvironment().GetOrAddPropertyDescriptor(LocationPropertyHash) == nullptr)
+		{
+			InBenchmark.Skip(TEXT("Property"), TEXT("component properties not bound"));
+
+			return;
+		}
+
+		const auto GarbageCollectionHandle = FCSharpEnvironment::GetEnvironment().GetGarbageCollectionHandle(InObject);
+
+		int32 Value{};
+
+		InBenchmark.RunManaged(TEXT("Property.Get.Primitive"), 1, CallIterations, [&](const int32)
+		{
+			GetObjectProperty(GarbageCollectionHandle, PriorityPropertyHash, reinterpret_cast<uint8*>(&Value));
+		});
+
+		InBenchmark.RunManaged(TEXT("Property.Set.Primitive"), 1, CallIterations, [&](const int32 Index)
+		{
+			Value = Index;
+
+			SetObjectProperty(GarbageCollectionHandle, PriorityPropertyHash, reinterpret_cast<uint8*>(&Value));
+		});
+
+		void* ReturnBuffer{};
+
+		InBenchmark.RunManaged(TEXT("Property.Get.Compound"), 1, CompoundIterations, [&](const int32)
+		{
+			GetObjectProperty(GarbageCollectionHandle, LocationPropertyHash, reinterpret_cast<uint8*>(&ReturnBuffer));
+		});
+	}
+
+	void RunContainerBenchmark(FInteropBenchmark& InBenchmark)
+	{
+		// Element properties are owned by the benchmark, containers only borrow them like the cached ones
+		const TUniquePtr<FIntProperty> KeyProperty(new FIntProperty(nullptr, "", RF_Transient));
+
+		const TUniquePtr<FIntProperty> ValueProperty(new FIntProperty(nullptr, "", RF_Transient));
+
+		KeyProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
+
+		ValueProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
+
+		int32 Key{};
+
+		int32 Value{};
+
+		{
+			const FArrayHelper ArrayHelper(ValueProperty.Get(), nullptr, true, false);
+
+			InBenchmark.RunNative(TEXT("Array.Add"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				if (ArrayHelper.Num() == ContainerSize)
+				{
+					ArrayHelper.Reset(ContainerSize);
+				}
+
+				Value = Index;
+
+				ArrayHelper.Add(&Value);
+			});
+
+			ArrayHelper.SetNum(ContainerSize, false);
+
+			InBenchmark.RunNative(TEXT("Array.Get"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				ArrayHelper.GetInnerPropertyDescriptor()->Get(ArrayHelper.Get(Index % ContainerSize),
+				                                              reinterpret_cast<void**>(&Value));
+			});
+
+			InBenchmark.RunNative(TEXT("Array.Set"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				Value = Index;
+
+				ArrayHelper.Set(Index % ContainerSize, &Value);
+			});
+		}
+
+		{
+			const FMapHelper MapHelper(KeyProperty.Get(), ValueProperty.Get(), nullptr, true, false);
+
+			InBenchmark.RunNative(TEXT("Map.Set"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				Key = Index % ContainerSize;
+
+				Value = Index;
+
+				MapHelper.Set(&Key, &Value);
+			});
+
+			InBenchmark.RunNative(TEXT("Map.Get"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				Key = Index % ContainerSize;
+
+				MapHelper.GetValuePropertyDescriptor()->Get(MapHelper.Get(&Key), reinterpret_cast<void**>(&Value));
+			});
+		}
+
+		{
+			const FSetHelper SetHelper(ValueProperty.Get(), nullptr, true, false);
+
+			InBenchmark.RunNative(TEXT("Set.Add"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				Value = Index % ContainerSize;
+
+				SetHelper.Add(&Value);
+			});
+
+			InBenchmark.RunNative(TEXT("Set.Contains"), ContainerSize, ContainerIterations, [&](const int32 Index)
+			{
+				Value = Index % (ContainerSize * 2);
+
+				SetHelper.Contains(&Value);
+			});
+		}
+	}
+
+	void RunMulticastDelegateBenchmark(FInteropBenchmark& InBenchmark, UPrimitiveComponent* InComponent)
+	{
+		const auto SignatureFunction = InComponent->FindFunction(
+			GET_FUNCTION_NAME_CHECKED(UPrimitiveComponent, WakeAllRigidBodies));
+
+		if (SignatureFunction == nullptr)
+		{
+			InBenchmark.Skip(TEXT("MulticastDelegate"), TEXT("signature function not found"));
+
+			return;
+		}
+
+		FMulticastScriptDelegate MulticastScriptDelegate;
+
+		FScriptDelegate ScriptDelegate;
+
+		ScriptDelegate.BindUFunction(InComponent, SignatureFunction->GetFName());
+
+		MulticastScriptDelegate.AddUnique(ScriptDelegate);
+
+		const FMulticastDelegateHelper MulticastDelegateHelper(&MulticastScriptDelegate, SignatureFunction);
+
+		InBenchmark.RunNative(TEXT("MulticastDelegate.Broadcast0"), 1, CallIterations, [&](const int32)
+		{
+			MulticastDelegateHelper.Broadcast0<>();
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteropBenchmarkTest, "UnrealCSharp.Benchmark.Interop",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                 EAutomationTestFlags::PerfFilter)
+
+bool FInteropBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FInteropBenchmark Benchmark(this);
+
+	if (!Benchmark.IsManaged())
+	{
+		AddWarning(TEXT("Domain is not active, managed cases are skipped"));
+	}
+
+	const auto Component = NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	Component->AddToRoot();
+
+	RunFunctionBenchmark(Benchmark);
+
+	RunCallCSharpBenchmark(Benchmark);
+
+	RunPropertyBenchmark(Benchmark, Component);
+
+	RunContainerBenchmark(Benchmark);
+
+	RunMulticastDelegateBenchmark(Benchmark, Component);
+
+	Component->RemoveFromRoot();
+
+	return TestTrue(TEXT("Benchmark results saved"), Benchmark.Save());
+}
+
+#endif
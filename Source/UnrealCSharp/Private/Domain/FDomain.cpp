@@ -275,6 +275,11 @@ mono_bool FDomain::Type_Is_ByRef(MonoType* InMonoType) const
 	return FMonoDomain::Type_Is_ByRef(InMonoType);
 }
 
+mono_bool FDomain::Type_Is_Reference(MonoType* InMonoType)
+{
+	return FMonoDomain::Type_Is_Reference(InMonoType);
+}
+
 MonoReflectionMethod* FDomain::Method_Get_Object(MonoMethod* InMethod, MonoClass* InMonoClass) const
 {
 	return FMonoDomain::Method_Get_Object(InMethod, InMonoClass);
@@ -347,6 +352,21 @@ char* FDomain::String_To_UTF8(MonoString* InMonoString) const
 	return FMonoDomain::String_To_UTF8(InMonoString);
 }
 
+MonoString* FDomain::String_New_UTF16(const mono_unichar2* InText, const int32 InLength) const
+{
+	return FMonoDomain::String_New_UTF16(InText, InLength);
+}
+
+mono_unichar2* FDomain::String_Chars(MonoString* InMonoString) const
+{
+	return FMonoDomain::String_Chars(InMonoString);
+}
+
+int32 FDomain::String_Length(MonoString* InMonoString) const
+{
+	return FMonoDomain::String_Length(InMonoString);
+}
+
 MonoArray* FDomain::Array_New(MonoClass* InMonoClass, const uint32 InNum) const
 {
 	return FMonoDomain::Array_New(InMonoClass, InNum);
@@ -552,6 +572,16 @@ mono_bool FDomain::Type_Is_Enum(MonoType* InMonoType)
 	return FMonoDomain::Type_Is_Enum(InMonoType);
 }
 
+MonoString* FDomain::String_New(const TCHAR* InText, const int32 InLength) const
+{
+	return FMonoDomain::String_New(InText, InLength);
+}
+
+FString FDomain::String_To_FString(MonoString* InMonoString)
+{
+	return FMonoDomain::String_To_FString(InMonoString);
+}
+
 void FDomain::InitializeSynchronizationContext()
 {
 	if (const auto SynchronizationContextClass = Class_From_Name(
@@ -31,11 +31,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<
-					FArrayHelper>(InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<
+						FArrayHelper>(InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static int32 GetTypeSizeImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
@@ -315,6 +316,43 @@ namespace
 			}
 		}
 
+		static void* GetDataImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                   const int32 InTypeSize)
+		{
+			if (const auto ArrayHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FArrayHelper>(
+				InGarbageCollectionHandle))
+			{
+				return ArrayHelper->GetData(InTypeSize);
+			}
+
+			return nullptr;
+		}
+
+		static int32 CopyToImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                  void* OutBuffer, const int32 InIndex, const int32 InCount,
+		                                  const int32 InTypeSize)
+		{
+			if (const auto ArrayHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FArrayHelper>(
+				InGarbageCollectionHandle))
+			{
+				return ArrayHelper->CopyTo(OutBuffer, InIndex, InCount, InTypeSize);
+			}
+
+			return 0;
+		}
+
+		static bool CopyFromImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                   const void* InBuffer, const int32 InCount, const int32 InTypeSize)
+		{
+			if (const auto ArrayHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FArrayHelper>(
+				InGarbageCollectionHandle))
+			{
+				return ArrayHelper->CopyFrom(InBuffer, InCount, InTypeSize);
+			}
+
+			return false;
+		}
+
 		static int32 INDEX_NONEImplementation()
 		{
 			return INDEX_NONE;
@@ -351,6 +389,9 @@ namespace
 				.Function("Remove", RemoveImplementation)
 				.Function("SwapMemory", SwapMemoryImplementation)
 				.Function("Swap", SwapImplementation)
+				.Function("GetData", GetDataImplementation)
+				.Function("CopyTo", CopyToImplementation)
+				.Function("CopyFrom", CopyFromImplementation)
 				.Function("INDEX_NONE", INDEX_NONEImplementation);
 		}
 	};
@@ -17,11 +17,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveDelegateReference<FDelegateHelper>(
-					InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveDelegateReference<FDelegateHelper>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static void BindImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
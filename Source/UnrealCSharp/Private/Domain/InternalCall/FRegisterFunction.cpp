@@ -319,6 +319,248 @@ namespace
 			}
 		}
 
+		static void StaticGenericCall0Implementation(const uint32 InFunctionHash)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call0<>(DefaultObject);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall1Implementation(const uint32 InFunctionHash, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call1<EFunctionReturnType::Primitive>(DefaultObject, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall1Implementation(const uint32 InFunctionHash, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call1<EFunctionReturnType::Compound>(DefaultObject, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall2Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call2<>(DefaultObject, IN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall3Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                               RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call3<EFunctionReturnType::Primitive>(DefaultObject, IN_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall3Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                              RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call3<EFunctionReturnType::Compound>(DefaultObject, IN_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall4Implementation(const uint32 InFunctionHash, OUT_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call4<>(DefaultObject, OUT_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall6Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                             OUT_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call6<>(DefaultObject, IN_BUFFER, OUT_BUFFER);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall7Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                               OUT_BUFFER_SIGNATURE, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call7<EFunctionReturnType::Primitive>(
+						DefaultObject, IN_BUFFER, OUT_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall7Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                              OUT_BUFFER_SIGNATURE, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call7<EFunctionReturnType::Compound>(
+						DefaultObject, IN_BUFFER, OUT_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall8Implementation(const uint32 InFunctionHash)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call8<>(DefaultObject);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall9Implementation(const uint32 InFunctionHash, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call9<EFunctionReturnType::Primitive>(DefaultObject, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall9Implementation(const uint32 InFunctionHash, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call9<EFunctionReturnType::Compound>(DefaultObject, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall10Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call10<>(DefaultObject, IN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall11Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                                RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call11<EFunctionReturnType::Primitive>(DefaultObject, IN_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall11Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                               RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call11<EFunctionReturnType::Compound>(DefaultObject, IN_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticGenericCall14Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                              OUT_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call14<>(DefaultObject, IN_BUFFER, OUT_BUFFER);
+				}
+			}
+		}
+
+		static void StaticPrimitiveCall15Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                                OUT_BUFFER_SIGNATURE, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call15<EFunctionReturnType::Primitive>(
+						DefaultObject, IN_BUFFER, OUT_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
+		static void StaticCompoundCall15Implementation(const uint32 InFunctionHash, IN_BUFFER_SIGNATURE,
+		                                               OUT_BUFFER_SIGNATURE, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FunctionDescriptor = static_cast<FUnrealFunctionDescriptor*>(
+				FCSharpEnvironment::GetEnvironment().GetOrAddFunctionDescriptor(InFunctionHash)))
+			{
+				if (const auto DefaultObject = FunctionDescriptor->GetDefaultObject())
+				{
+					FunctionDescriptor->Call15<EFunctionReturnType::Compound>(
+						DefaultObject, IN_BUFFER, OUT_BUFFER, RETURN_BUFFER);
+				}
+			}
+		}
+
 		FRegisterFunction()
 		{
 			FClassBuilder(TEXT("FFunction"), NAMESPACE_LIBRARY)
@@ -344,7 +586,26 @@ namespace
 				.Function("GenericCall16", GenericCall16Implementation)
 				.Function("GenericCall18", GenericCall18Implementation)
 				.Function("GenericCall24", GenericCall24Implementation)
-				.Function("GenericCall26", GenericCall26Implementation);
+				.Function("GenericCall26", GenericCall26Implementation)
+				.Function("StaticGenericCall0", StaticGenericCall0Implementation)
+				.Function("StaticPrimitiveCall1", StaticPrimitiveCall1Implementation)
+				.Function("StaticCompoundCall1", StaticCompoundCall1Implementation)
+				.Function("StaticGenericCall2", StaticGenericCall2Implementation)
+				.Function("StaticPrimitiveCall3", StaticPrimitiveCall3Implementation)
+				.Function("StaticCompoundCall3", StaticCompoundCall3Implementation)
+				.Function("StaticGenericCall4", StaticGenericCall4Implementation)
+				.Function("StaticGenericCall6", StaticGenericCall6Implementation)
+				.Function("StaticPrimitiveCall7", StaticPrimitiveCall7Implementation)
+				.Function("StaticCompoundCall7", StaticCompoundCall7Implementation)
+				.Function("StaticGenericCall8", StaticGenericCall8Implementation)
+				.Function("StaticPrimitiveCall9", StaticPrimitiveCall9Implementation)
+				.Function("StaticCompoundCall9", StaticCompoundCall9Implementation)
+				.Function("StaticGenericCall10", StaticGenericCall10Implementation)
+				.Function("StaticPrimitiveCall11", StaticPrimitiveCall11Implementation)
+				.Function("StaticCompoundCall11", StaticCompoundCall11Implementation)
+				.Function("StaticGenericCall14", StaticGenericCall14Implementation)
+				.Function("StaticPrimitiveCall15", StaticPrimitiveCall15Implementation)
+				.Function("StaticCompoundCall15", StaticCompoundCall15Implementation);
 		}
 	};
 
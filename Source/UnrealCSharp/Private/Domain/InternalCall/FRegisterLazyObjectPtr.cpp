@@ -32,11 +32,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveMultiReference<TLazyObjectPtr<UObject>>(
-					InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveMultiReference<TLazyObjectPtr<UObject>>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static MonoObject* GetImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
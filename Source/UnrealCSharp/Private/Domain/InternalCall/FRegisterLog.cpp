@@ -14,7 +14,7 @@ namespace
 #if !NO_LOGGING
 			if (UE_LOG_ACTIVE(LogUnrealCSharp, Log))
 			{
-				GLog->Serialize(StringCast<TCHAR>(InBuffer + 2 * sizeof(void*)).Get() + InReadOffset,
+				GLog->Serialize(StringCast<TCHAR>(InBuffer + 2 * sizeof(void*) + InReadOffset).Get(),
 				                ELogVerbosity::Log, LogUnrealCSharp.GetCategoryName());
 			}
 #endif
@@ -20,11 +20,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<FMapHelper>(
-					InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<FMapHelper>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static void EmptyImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
@@ -69,6 +70,16 @@ namespace
 			}
 		}
 
+		static void AppendImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                 const int32 InNum, IN_KEY_BUFFER_SIGNATURE, IN_VALUE_BUFFER_SIGNATURE)
+		{
+			if (const auto MapHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FMapHelper>(
+				InGarbageCollectionHandle))
+			{
+				MapHelper->Append(InNum, IN_KEY_BUFFER, IN_VALUE_BUFFER);
+			}
+		}
+
 		static int32 RemoveImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                  const IN_KEY_BUFFER_SIGNATURE)
 		{
@@ -183,6 +194,21 @@ namespace
 			}
 		}
 
+		static int32 EnumerateImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                     int32* InOutIndex, void* OutKeyBuffer, void* OutValueBuffer,
+		                                     const int32 InCount, const int32 InKeyTypeSize,
+		                                     const int32 InValueTypeSize)
+		{
+			if (const auto MapHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FMapHelper>(
+				InGarbageCollectionHandle))
+			{
+				return MapHelper->Enumerate(*InOutIndex, OutKeyBuffer, OutValueBuffer, InCount, InKeyTypeSize,
+				                            InValueTypeSize);
+			}
+
+			return 0;
+		}
+
 		FRegisterMap()
 		{
 			FClassBuilder(TEXT("TMap"), NAMESPACE_LIBRARY)
@@ -192,6 +218,7 @@ namespace
 				.Function("Num", NumImplementation)
 				.Function("IsEmpty", IsEmptyImplementation)
 				.Function("Add", AddImplementation)
+				.Function("Append", AppendImplementation)
 				.Function("Remove", RemoveImplementation)
 				.Function("FindKey", FindKeyImplementation)
 				.Function("Find", FindImplementation)
@@ -201,7 +228,8 @@ namespace
 				.Function("GetMaxIndex", GetMaxIndexImplementation)
 				.Function("IsValidIndex", IsValidIndexImplementation)
 				.Function("GetEnumeratorKey", GetEnumeratorKeyImplementation)
-				.Function("GetEnumeratorValue", GetEnumeratorValueImplementation);
+				.Function("GetEnumeratorValue", GetEnumeratorValueImplementation)
+				.Function("Enumerate", EnumerateImplementation);
 		}
 	};
 
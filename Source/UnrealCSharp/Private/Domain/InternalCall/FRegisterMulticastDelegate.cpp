@@ -17,11 +17,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveDelegateReference<FMulticastDelegateHelper>(
-					InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveDelegateReference<FMulticastDelegateHelper>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static bool IsBoundImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
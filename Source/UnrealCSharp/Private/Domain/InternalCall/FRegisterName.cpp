@@ -9,8 +9,12 @@ namespace
 	{
 		static void RegisterImplementation(MonoObject* InMonoObject, MonoString* InValue)
 		{
-			const auto Name = new FName(UTF8_TO_TCHAR(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InValue)));
+			const auto Domain = FCSharpEnvironment::GetEnvironment().GetDomain();
+
+			const auto Value = StringCast<TCHAR>(reinterpret_cast<const UTF16CHAR*>(Domain->String_Chars(InValue)),
+			                                     Domain->String_Length(InValue));
+
+			const auto Name = new FName(Value.Length(), Value.Get());
 
 			FCSharpEnvironment::GetEnvironment().AddStringReference<FName, true>(InMonoObject, Name);
 		}
@@ -30,17 +34,24 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FName>(InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FName>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static MonoString* ToStringImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
 			const auto Name = FCSharpEnvironment::GetEnvironment().GetString<FName>(InGarbageCollectionHandle);
 
-			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(TCHAR_TO_UTF8(*Name->ToString()));
+			TStringBuilder<FName::StringBufferSize> NameBuilder;
+
+			Name->AppendString(NameBuilder);
+
+			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(
+				NameBuilder.GetData(), NameBuilder.Len());
 		}
 
 		static MonoObject* NAME_NoneImplementation()
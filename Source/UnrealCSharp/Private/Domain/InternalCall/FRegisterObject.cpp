@@ -23,10 +23,9 @@ namespace
 
 		static MonoObject* StaticClassImplementation(MonoString* InClassName)
 		{
-			const auto ClassName = StringCast<TCHAR>(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InClassName));
+			const auto ClassName = FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_FString(InClassName);
 
-			const auto InClass = LoadObject<UClass>(nullptr, ClassName.Get());
+			const auto InClass = LoadObject<UClass>(nullptr, *ClassName);
 
 			return FCSharpEnvironment::GetEnvironment().Bind(InClass);
 		}
@@ -18,11 +18,12 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<FSetHelper>(
-					InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<FSetHelper>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static void EmptyImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
@@ -78,6 +79,16 @@ namespace
 			}
 		}
 
+		static void AppendImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                 const int32 InNum, IN_VALUE_BUFFER_SIGNATURE)
+		{
+			if (const auto SetHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FSetHelper>(
+				InGarbageCollectionHandle))
+			{
+				SetHelper->Append(InNum, IN_VALUE_BUFFER);
+			}
+		}
+
 		static int32 RemoveImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                  const IN_VALUE_BUFFER_SIGNATURE)
 		{
@@ -126,6 +137,19 @@ namespace
 			}
 		}
 
+		static int32 EnumerateImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                     int32* InOutIndex, void* OutBuffer, const int32 InCount,
+		                                     const int32 InTypeSize)
+		{
+			if (const auto SetHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FSetHelper>(
+				InGarbageCollectionHandle))
+			{
+				return SetHelper->Enumerate(*InOutIndex, OutBuffer, InCount, InTypeSize);
+			}
+
+			return 0;
+		}
+
 		FRegisterSet()
 		{
 			FClassBuilder(TEXT("TSet"), NAMESPACE_LIBRARY)
@@ -136,10 +160,12 @@ namespace
 				.Function("IsEmpty", IsEmptyImplementation)
 				.Function("GetMaxIndex", GetMaxIndexImplementation)
 				.Function("Add", AddImplementation)
+				.Function("Append", AppendImplementation)
 				.Function("Remove", RemoveImplementation)
 				.Function("Contains", ContainsImplementation)
 				.Function("IsValidIndex", IsValidIndexImplementation)
-				.Function("GetEnumerator", GetEnumeratorImplementation);
+				.Function("GetEnumerator", GetEnumeratorImplementation)
+				.Function("Enumerate", EnumerateImplementation);
 		}
 	};
 
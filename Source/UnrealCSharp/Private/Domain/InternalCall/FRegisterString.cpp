@@ -9,8 +9,8 @@ namespace
 	{
 		static void RegisterImplementation(MonoObject* InMonoObject, MonoString* InValue)
 		{
-			const auto String = new FString(UTF8_TO_TCHAR(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InValue)));
+			const auto String = new FString(
+				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_FString(InValue));
 
 			FCSharpEnvironment::GetEnvironment().AddStringReference<FString, true>(InMonoObject, String);
 		}
@@ -30,17 +30,19 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FString>(InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FString>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static MonoString* ToStringImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			auto String = FCSharpEnvironment::GetEnvironment().GetString<FString>(InGarbageCollectionHandle);
+			const auto String = FCSharpEnvironment::GetEnvironment().GetString<FString>(InGarbageCollectionHandle);
 
-			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(TCHAR_TO_UTF8(*FString(*String)));
+			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(**String, String->Len());
 		}
 
 		FRegisterString()
@@ -9,20 +9,18 @@ namespace
 	{
 		static MonoObject* StaticStructImplementation(MonoString* InStructName)
 		{
-			const auto StructName = StringCast<TCHAR>(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InStructName));
+			const auto StructName = FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_FString(InStructName);
 
-			const auto InStruct = LoadObject<UScriptStruct>(nullptr, StructName.Get());
+			const auto InStruct = LoadObject<UScriptStruct>(nullptr, *StructName);
 
 			return FCSharpEnvironment::GetEnvironment().Bind(InStruct);
 		}
 
 		static void RegisterImplementation(MonoObject* InMonoObject, MonoString* InStructName)
 		{
-			const auto StructName = StringCast<TCHAR>(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InStructName));
+			const auto StructName = FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_FString(InStructName);
 
-			FCSharpEnvironment::GetEnvironment().Bind(InMonoObject, StructName.Get());
+			FCSharpEnvironment::GetEnvironment().Bind(InMonoObject, *StructName);
 		}
 
 		static bool IdenticalImplementation(const FGarbageCollectionHandle InScriptStruct,
@@ -46,10 +44,11 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStructReference(InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveStructReference(InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		FRegisterStruct()
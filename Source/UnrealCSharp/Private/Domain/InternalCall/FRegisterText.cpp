@@ -9,8 +9,8 @@ namespace
 	{
 		static void RegisterImplementation(MonoObject* InMonoObject, MonoString* InValue)
 		{
-			const auto Text = new FText(FText::FromString(UTF8_TO_TCHAR(
-				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_UTF8(InValue))));
+			const auto Text = new FText(FText::FromString(
+				FCSharpEnvironment::GetEnvironment().GetDomain()->String_To_FString(InValue)));
 
 			FCSharpEnvironment::GetEnvironment().AddStringReference<FText, true>(InMonoObject, Text);
 		}
@@ -30,17 +30,21 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
-			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FText>(InGarbageCollectionHandle);
-			});
+			FCSharpEnvironment::GetEnvironment().AsyncRelease(
+				[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+				{
+					(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FText>(
+						InReleaseGarbageCollectionHandle);
+				}, InGarbageCollectionHandle);
 		}
 
 		static MonoString* ToStringImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
 			const auto Text = FCSharpEnvironment::GetEnvironment().GetString<FText>(InGarbageCollectionHandle);
 
-			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(TCHAR_TO_UTF8(*Text->ToString()));
+			const auto& String = Text->ToString();
+
+			return FCSharpEnvironment::GetEnvironment().GetDomain()->String_New(*String, String.Len());
 		}
 
 		FRegisterText()
@@ -3,7 +3,10 @@
 #include "Registry/FDelegateRegistry.h"
 #include "Registry/FBindingRegistry.h"
 #include "Registry/FCSharpBind.h"
+#include "Reflection/Container/FContainerElementPropertyCache.h"
+#include "Reflection/Delegate/FMulticastDelegateHelper.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
+#include "Setting/UnrealCSharpSetting.h"
 #include "Delegate/FUnrealCSharpModuleDelegates.h"
 #include "Log/UnrealCSharpLog.h"
 #include <signal.h>
@@ -83,9 +86,21 @@ void FCSharpEnvironment::Initialize()
 	OptionalRegistry = new FOptionalRegistry();
 #endif
 
+	const auto UnrealCSharpSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<UUnrealCSharpSetting>();
+
+	AsyncLoadingBindTimeBudget = UnrealCSharpSetting != nullptr
+		                             ? UnrealCSharpSetting->GetAsyncLoadingBindTimeBudget() / 1000.0
+		                             : 0.0;
+
 	OnAsyncLoadingFlushUpdateHandle = FCoreDelegates::OnAsyncLoadingFlushUpdate.AddRaw(
 		this, &FCSharpEnvironment::OnAsyncLoadingFlushUpdate);
 
+	OnAsyncLoadingTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FCSharpEnvironment::OnAsyncLoadingTick));
+
+	OnReleaseTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FCSharpEnvironment::OnReleaseTick));
+
 	static TSet<int32> SignalTypes = {
 		// interrupt
 		SIGINT,
@@ -134,6 +149,8 @@ void FCSharpEnvironment::Initialize()
 
 void FCSharpEnvironment::Deinitialize()
 {
+	AsyncLoadingObjectQueue.Empty();
+
 	AsyncLoadingObjectArray.Empty();
 
 	if (OnAsyncLoadingFlushUpdateHandle.IsValid())
@@ -141,6 +158,22 @@ void FCSharpEnvironment::Deinitialize()
 		FCoreDelegates::OnAsyncLoadingFlushUpdate.Remove(OnAsyncLoadingFlushUpdateHandle);
 	}
 
+	if (OnAsyncLoadingTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(OnAsyncLoadingTickHandle);
+
+		OnAsyncLoadingTickHandle.Reset();
+	}
+
+	if (OnReleaseTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(OnReleaseTickHandle);
+
+		OnReleaseTickHandle.Reset();
+	}
+
+	ReleaseQueue.Drain();
+
 #if UE_F_OPTIONAL_PROPERTY
 	if (OptionalRegistry != nullptr)
 	{
@@ -227,12 +260,19 @@ void FCSharpEnvironment::Deinitialize()
 		DynamicRegistry = nullptr;
 	}
 
+	FContainerElementPropertyCache::Empty();
+
+	// Pooled handlers outlive the helpers that released them, they must not stay rooted past the domain
+	FMulticastDelegateHelper::EmptyHandlerPool();
+
 	if (Domain != nullptr)
 	{
 		delete Domain;
 
 		Domain = nullptr;
 	}
+
+	ReleaseQueue.Empty();
 }
 
 FCSharpEnvironment& FCSharpEnvironment::GetEnvironment()
@@ -251,9 +291,7 @@ void FCSharpEnvironment::NotifyUObjectCreated(const UObjectBase* Object, int32 I
 	{
 		if (InObject->HasAnyFlags(EObjectFlags::RF_ClassDefaultObject))
 		{
-			FScopeLock Lock(&CriticalSection);
-
-			AsyncLoadingObjectArray.Add(InObject);
+			AsyncLoadingObjectQueue.Enqueue(InObject);
 
 			return;
 		}
@@ -264,9 +302,7 @@ void FCSharpEnvironment::NotifyUObjectCreated(const UObjectBase* Object, int32 I
 		}
 		else
 		{
-			FScopeLock Lock(&CriticalSection);
-
-			AsyncLoadingObjectArray.Add(InObject);
+			AsyncLoadingObjectQueue.Enqueue(InObject);
 		}
 	}
 }
@@ -302,84 +338,111 @@ void FCSharpEnvironment::OnUnrealCSharpModuleInActive()
 
 void FCSharpEnvironment::OnAsyncLoadingFlushUpdate()
 {
-	TArray<int32> RemovedIndexes;
-
-	TArray<UObject*> PendingBindObjects;
+	FWeakObjectPtr AsyncLoadingObject;
 
+	while (AsyncLoadingObjectQueue.Dequeue(AsyncLoadingObject))
 	{
-		TArray<FWeakObjectPtr> LocalAsyncLoadingObjectArray;
-
-		{
-			FScopeLock Lock(&CriticalSection);
+		AsyncLoadingObjectArray.Add(AsyncLoadingObject);
+	}
 
-			LocalAsyncLoadingObjectArray.Append(AsyncLoadingObjectArray);
-		}
+	if (AsyncLoadingObjectArray.IsEmpty())
+	{
+		return;
+	}
 
-		for (auto i = LocalAsyncLoadingObjectArray.Num() - 1; i >= 0; --i)
-		{
-			auto ObjectPtr = LocalAsyncLoadingObjectArray[i];
+	const auto EndTime = FPlatformTime::Seconds() + AsyncLoadingBindTimeBudget;
 
-			if (!ObjectPtr.IsValid())
-			{
-				RemovedIndexes.Add(i);
+	TArray<UObject*> PendingBindObjects;
 
-				continue;
-			}
+	// Binding runs managed constructors which may flush async loading and re-enter here,
+	// so ready objects are taken out in a single pass before any of them is bound
+	AsyncLoadingObjectArray.RemoveAll([&PendingBindObjects](const FWeakObjectPtr& InAsyncLoadingObject)
+	{
+		const auto Object = InAsyncLoadingObject.Get();
 
-			auto Object = ObjectPtr.Get();
+		if (Object == nullptr)
+		{
+			return true;
+		}
 
-			if (Object->HasAnyFlags(RF_NeedPostLoad) ||
-				Object->HasAnyInternalFlags(
+		if (Object->HasAnyFlags(RF_NeedPostLoad) ||
+			Object->HasAnyInternalFlags(
 #if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
-					EInternalObjectFlags_AsyncLoading
+				EInternalObjectFlags_AsyncLoading
 #else
-					EInternalObjectFlags::AsyncLoading
+				EInternalObjectFlags::AsyncLoading
 #endif
-					| EInternalObjectFlags::Async) ||
-				Object->GetClass()->HasAnyInternalFlags(
+				| EInternalObjectFlags::Async) ||
+			Object->GetClass()->HasAnyInternalFlags(
 #if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
-					EInternalObjectFlags_AsyncLoading
+				EInternalObjectFlags_AsyncLoading
 #else
-					EInternalObjectFlags::AsyncLoading
+				EInternalObjectFlags::AsyncLoading
 #endif
-					| EInternalObjectFlags::Async))
-			{
-				continue;
-			}
+				| EInternalObjectFlags::Async))
+		{
+			return false;
+		}
 
-			PendingBindObjects.Add(Object);
+		PendingBindObjects.Add(Object);
 
-			RemovedIndexes.Add(i);
-		}
-	}
+		return true;
+	});
 
+	// Bound newest first, the order this update has always used
+	for (auto Index = PendingBindObjects.Num() - 1; Index >= 0; --Index)
 	{
-		FScopeLock Lock(&CriticalSection);
-
-		for (const auto RemovedIndex : RemovedIndexes)
+		// Whatever is left over is picked up by the next flush update or tick
+		if (AsyncLoadingBindTimeBudget > 0.0 && FPlatformTime::Seconds() >= EndTime)
 		{
-			AsyncLoadingObjectArray.RemoveAt(RemovedIndex);
+			for (auto LeftIndex = 0; LeftIndex <= Index; ++LeftIndex)
+			{
+				AsyncLoadingObjectArray.Add(PendingBindObjects[LeftIndex]);
+			}
+
+			break;
 		}
-	}
 
-	for (const auto& PendingBindObject : PendingBindObjects)
-	{
-		if (PendingBindObject->HasAnyFlags(EObjectFlags::RF_ClassDefaultObject))
+		const auto Object = PendingBindObjects[Index];
+
+		if (Object->HasAnyFlags(EObjectFlags::RF_ClassDefaultObject))
 		{
-			FCSharpBind::BindClassDefaultObject(Domain, PendingBindObject);
+			FCSharpBind::BindClassDefaultObject(Domain, Object);
 		}
 		else
 		{
-			Bind<true>(PendingBindObject);
+			Bind<true>(Object);
 		}
 
-		if (const auto FoundMonoObject = GetObject(PendingBindObject))
+		if (const auto FoundMonoObject = GetObject(Object))
 		{
 			FDomain::Object_Constructor(FoundMonoObject);
 		}
 	}
 }
 
+bool FCSharpEnvironment::OnAsyncLoadingTick(float InDeltaTime)
+{
+	OnAsyncLoadingFlushUpdate();
+
+	return true;
+}
+
+bool FCSharpEnvironment::OnReleaseTick(float InDeltaTime)
+{
+	if (const auto UnrealCSharpSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+		UUnrealCSharpSetting>())
+	{
+		ReleaseQueue.Drain(UnrealCSharpSetting->GetReleaseTimeBudget() / 1000.0);
+	}
+	else
+	{
+		ReleaseQueue.Drain();
+	}
+
+	return true;
+}
+
 MonoObject* FCSharpEnvironment::Bind(UObject* Object) const
 {
 	return FCSharpBind::Bind(Domain, Object);
@@ -589,6 +652,12 @@ bool FCSharpEnvironment::RemoveOptionalReference(const FGarbageCollectionHandle&
 }
 #endif
 
+void FCSharpEnvironment::AsyncRelease(const FGarbageCollectionReleaseQueue::ReleaseType InRelease,
+                                      const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	ReleaseQueue.Enqueue(InRelease, InGarbageCollectionHandle);
+}
+
 bool FCSharpEnvironment::AddReference(const FGarbageCollectionHandle& InOwner, FReference* InReference) const
 {
 	return ReferenceRegistry != nullptr ? ReferenceRegistry->AddReference(InOwner, InReference) : false;
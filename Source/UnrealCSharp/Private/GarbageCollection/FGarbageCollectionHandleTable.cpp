@@ -0,0 +1,63 @@
+﻿#include "GarbageCollection/FGarbageCollectionHandleTable.h"
+
+namespace
+{
+	constexpr auto HandleTypeShift = 3;
+
+	constexpr auto HandleTypeMask = (1 << HandleTypeShift) - 1;
+
+	// Weak, weak track resurrection, normal and pinned
+	constexpr auto HandleTypeCount = 4;
+}
+
+int32 FGarbageCollectionHandleTable::Get(const FGarbageCollectionHandle& InGarbageCollectionHandle) const
+{
+	const auto Slot = GetSlot(InGarbageCollectionHandle);
+
+	return Slot < static_cast<uint32>(Indices.Num()) ? Indices[Slot] : INDEX_NONE;
+}
+
+void FGarbageCollectionHandleTable::Set(const FGarbageCollectionHandle& InGarbageCollectionHandle, const int32 InIndex)
+{
+	const auto Slot = GetSlot(InGarbageCollectionHandle);
+
+	if (Slot >= static_cast<uint32>(Indices.Num()))
+	{
+		const auto Num = Indices.Num();
+
+		Indices.SetNumUninitialized(FMath::Max(static_cast<int32>(Slot) + 1, Num * 2));
+
+		for (auto Index = Num; Index < Indices.Num(); ++Index)
+		{
+			Indices[Index] = INDEX_NONE;
+		}
+	}
+
+	Indices[Slot] = InIndex;
+}
+
+void FGarbageCollectionHandleTable::Reset(const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	if (!InGarbageCollectionHandle.IsValid())
+	{
+		return;
+	}
+
+	if (const auto Slot = GetSlot(InGarbageCollectionHandle); Slot < static_cast<uint32>(Indices.Num()))
+	{
+		Indices[Slot] = INDEX_NONE;
+	}
+}
+
+void FGarbageCollectionHandleTable::Empty()
+{
+	Indices.Empty();
+}
+
+uint32 FGarbageCollectionHandleTable::GetSlot(const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	const auto Handle = static_cast<uint32>(reinterpret_cast<UPTRINT>(
+		static_cast<GarbageCollectionHandleType>(InGarbageCollectionHandle)));
+
+	return (Handle >> HandleTypeShift) * HandleTypeCount + ((Handle & HandleTypeMask) - 1) % HandleTypeCount;
+}
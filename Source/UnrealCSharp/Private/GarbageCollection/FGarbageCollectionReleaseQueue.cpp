@@ -0,0 +1,36 @@
+﻿#include "GarbageCollection/FGarbageCollectionReleaseQueue.h"
+
+void FGarbageCollectionReleaseQueue::Enqueue(const ReleaseType InRelease,
+                                             const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	Queue.Enqueue({InRelease, InGarbageCollectionHandle});
+}
+
+void FGarbageCollectionReleaseQueue::Drain(const double InTimeBudget)
+{
+	check(IsInGameThread());
+
+	// Checking the clock for every handle would cost more than the release itself
+	static constexpr auto TimeCheckInterval = 64;
+
+	const auto EndTime = FPlatformTime::Seconds() + InTimeBudget;
+
+	auto Count = 0;
+
+	FRelease PendingRelease;
+
+	while (Queue.Dequeue(PendingRelease))
+	{
+		PendingRelease.Release(PendingRelease.GarbageCollectionHandle);
+
+		if (InTimeBudget > 0.0 && ++Count % TimeCheckInterval == 0 && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+}
+
+void FGarbageCollectionReleaseQueue::Empty()
+{
+	Queue.Empty();
+}
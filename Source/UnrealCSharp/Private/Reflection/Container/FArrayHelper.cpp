@@ -38,9 +38,12 @@ void FArrayHelper::Deinitialize()
 		ScriptArray = nullptr;
 	}
 
-	if (bNeedFreeProperty && InnerPropertyDescriptor != nullptr)
+	if (InnerPropertyDescriptor != nullptr)
 	{
-		InnerPropertyDescriptor->DestroyProperty();
+		if (bNeedFreeProperty)
+		{
+			InnerPropertyDescriptor->DestroyProperty();
+		}
 
 		delete InnerPropertyDescriptor;
 
@@ -331,6 +334,51 @@ void FArrayHelper::Swap(const int32 InFirstIndexToSwap, const int32 InSecondInde
 	ScriptArray->SwapMemory(InFirstIndexToSwap, InSecondIndexToSwap, InnerPropertyDescriptor->GetSize());
 }
 
+bool FArrayHelper::IsBlittable(const int32 InTypeSize) const
+{
+	// Only elements that are passed raw across the boundary share their layout with the managed side
+	return InnerPropertyDescriptor->IsPrimitiveProperty() && InnerPropertyDescriptor->GetElementSize() == InTypeSize;
+}
+
+void* FArrayHelper::GetData(const int32 InTypeSize) const
+{
+	return IsBlittable(InTypeSize) ? ScriptArray->GetData() : nullptr;
+}
+
+int32 FArrayHelper::CopyTo(void* OutBuffer, const int32 InIndex, const int32 InCount, const int32 InTypeSize) const
+{
+	if (!IsBlittable(InTypeSize) || InIndex < 0 || InCount <= 0 || InIndex >= ScriptArray->Num())
+	{
+		return 0;
+	}
+
+	const auto Count = FMath::Min(InCount, ScriptArray->Num() - InIndex);
+
+	FMemory::Memcpy(OutBuffer, static_cast<uint8*>(ScriptArray->GetData()) + InIndex * InTypeSize,
+	                Count * InTypeSize);
+
+	return Count;
+}
+
+bool FArrayHelper::CopyFrom(const void* InBuffer, const int32 InCount, const int32 InTypeSize) const
+{
+	if (!IsBlittable(InTypeSize) || InCount < 0)
+	{
+		return false;
+	}
+
+	auto ScriptArrayHelper = CreateHelperFormInnerProperty();
+
+	ScriptArrayHelper.Resize(InCount);
+
+	if (InCount > 0)
+	{
+		FMemory::Memcpy(ScriptArray->GetData(), InBuffer, InCount * InTypeSize);
+	}
+
+	return true;
+}
+
 FPropertyDescriptor* FArrayHelper::GetInnerPropertyDescriptor() const
 {
 	return InnerPropertyDescriptor;
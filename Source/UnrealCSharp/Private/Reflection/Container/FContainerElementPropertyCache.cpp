@@ -0,0 +1,34 @@
+﻿#include "Reflection/Container/FContainerElementPropertyCache.h"
+#include "Bridge/FTypeBridge.h"
+#include "Domain/FMonoDomain.h"
+
+TMap<MonoType*, FProperty*> FContainerElementPropertyCache::Properties;
+
+FProperty* FContainerElementPropertyCache::Get(MonoReflectionType* InReflectionType)
+{
+	// Reflection objects may be moved by the collector, the unmanaged type is stable
+	const auto Type = FMonoDomain::Reflection_Type_Get_Type(InReflectionType);
+
+	if (const auto FoundProperty = Properties.Find(Type))
+	{
+		return *FoundProperty;
+	}
+
+	const auto Property = FTypeBridge::Factory<>(InReflectionType, nullptr, "", EObjectFlags::RF_Transient);
+
+	Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
+
+	Properties.Add(Type, Property);
+
+	return Property;
+}
+
+void FContainerElementPropertyCache::Empty()
+{
+	for (const auto& [Key, Value] : Properties)
+	{
+		delete Value;
+	}
+
+	Properties.Empty();
+}
@@ -49,16 +49,19 @@ void FMapHelper::Deinitialize()
 		ScriptMap = nullptr;
 	}
 
-	if (bNeedFreeProperty && KeyPropertyDescriptor != nullptr && ValuePropertyDescriptor != nullptr)
+	if (KeyPropertyDescriptor != nullptr && ValuePropertyDescriptor != nullptr)
 	{
-		KeyPropertyDescriptor->DestroyProperty();
+		if (bNeedFreeProperty)
+		{
+			KeyPropertyDescriptor->DestroyProperty();
+
+			ValuePropertyDescriptor->DestroyProperty();
+		}
 
 		delete KeyPropertyDescriptor;
 
 		KeyPropertyDescriptor = nullptr;
 
-		ValuePropertyDescriptor->DestroyProperty();
-
 		delete ValuePropertyDescriptor;
 
 		ValuePropertyDescriptor = nullptr;
@@ -87,44 +90,22 @@ void FMapHelper::Add(void* InKey, void* InValue) const
 
 int32 FMapHelper::Remove(const void* InKey) const
 {
-	auto Count = 0;
+	const auto KeyIndex = FindPairIndex(InKey);
 
-	do
+	if (KeyIndex == INDEX_NONE)
 	{
-		auto KeyIndex = static_cast<int32>(INDEX_NONE);
-
-		for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
-		{
-			if (ScriptMap->IsValidIndex(Index))
-			{
-				if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-					KeyPropertyDescriptor->Identical(Data, InKey))
-				{
-					KeyIndex = Index;
-
-					break;
-				}
-			}
-		}
-
-		if (KeyIndex == INDEX_NONE)
-		{
-			break;
-		}
-
-		++Count;
+		return 0;
+	}
 
-		const auto Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
+	const auto Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
 
-		KeyPropertyDescriptor->DestroyValue(Data);
+	KeyPropertyDescriptor->DestroyValue(Data);
 
-		ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
+	ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
 
-		ScriptMap->RemoveAt(KeyIndex, ScriptMapLayout);
-	}
-	while (true);
+	ScriptMap->RemoveAt(KeyIndex, ScriptMapLayout);
 
-	return Count;
+	return 1;
 }
 
 void* FMapHelper::FindKey(const void* InValue) const
@@ -151,54 +132,139 @@ void* FMapHelper::Find(const void* InKey) const
 
 bool FMapHelper::Contains(const void* InKey) const
 {
-	return Get(InKey) != nullptr;
+	return FindPairIndex(InKey) != INDEX_NONE;
 }
 
 void* FMapHelper::Get(const void* InKey) const
 {
-	for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
+	const auto KeyIndex = FindPairIndex(InKey);
+
+	return KeyIndex != INDEX_NONE
+		       ? static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout)) + ScriptMapLayout.ValueOffset
+		       : nullptr;
+}
+
+void FMapHelper::Set(void* InKey, void* InValue) const
+{
+	auto Key = InKey;
+
+	if (!KeyPropertyDescriptor->IsPrimitiveProperty())
 	{
-		if (ScriptMap->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-				KeyPropertyDescriptor->Identical(Data, InKey))
-			{
-				return Data + ScriptMapLayout.ValueOffset;
-			}
-		}
+		Key = FMemory_Alloca_Aligned(KeyPropertyDescriptor->GetSize(), KeyPropertyDescriptor->GetMinAlignment());
+
+		FMemory::Memzero(Key, KeyPropertyDescriptor->GetSize());
+
+		KeyPropertyDescriptor->Set(InKey, Key);
 	}
 
-	return nullptr;
+	ScriptMap->Add(Key, InValue, ScriptMapLayout,
+	               [this](const void* InElementKey)
+	               {
+		               return KeyPropertyDescriptor->GetValueTypeHash(InElementKey);
+	               },
+	               [this](const void* InA, const void* InB)
+	               {
+		               return KeyPropertyDescriptor->GetProperty()->Identical(InA, InB);
+	               },
+	               [this, InKey](void* InNewElementKey)
+	               {
+		               KeyPropertyDescriptor->Set(InKey, InNewElementKey);
+	               },
+	               [this, InValue](void* InNewElementValue)
+	               {
+		               ValuePropertyDescriptor->Set(InValue, InNewElementValue);
+	               },
+	               [this, InValue](void* InElementValue)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(InElementValue);
+
+		               ValuePropertyDescriptor->Set(InValue, InElementValue);
+	               },
+	               [this](void* InElementKey)
+	               {
+		               KeyPropertyDescriptor->DestroyValue(InElementKey);
+	               },
+	               [this](void* InElementValue)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(InElementValue);
+	               });
+
+	if (Key != InKey)
+	{
+		KeyPropertyDescriptor->DestroyValue(Key);
+	}
 }
 
-void FMapHelper::Set(void* InKey, void* InValue) const
+void FMapHelper::Append(const int32 InNum, uint8* InKeys, uint8* InValues) const
 {
-	auto KeyIndex = static_cast<int32>(INDEX_NONE);
+	const auto KeyBufferSize = KeyPropertyDescriptor->GetBufferSize();
 
-	for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
+	const auto ValueBufferSize = ValuePropertyDescriptor->GetBufferSize();
+
+	if (InNum <= 0)
 	{
-		if (ScriptMap->IsValidIndex(Index))
+		return;
+	}
+
+	// FScriptMap has no Reserve, an empty map can take the slack through Empty
+	if (ScriptMap->Num() == 0)
+	{
+		ScriptMap->Empty(InNum, ScriptMapLayout);
+	}
+
+	// Only pairs from before the batch are linked into the hash, an empty map has no hash to probe at all
+	const auto bHasHash = ScriptMap->Num() > 0;
+
+	// Pairs added by this batch are not linked into the hash until the final rehash
+	TMultiMap<uint32, int32> AddedKeyIndexes;
+
+	for (auto Index = 0; Index < InNum; ++Index)
+	{
+		const auto Key = InKeys + Index * KeyBufferSize;
+
+		const auto Value = InValues + Index * ValueBufferSize;
+
+		const auto KeyHash = KeyPropertyDescriptor->GetBufferValueTypeHash(Key);
+
+		auto KeyIndex = bHasHash ? FindPairIndex(Key, KeyHash) : static_cast<int32>(INDEX_NONE);
+
+		if (KeyIndex == INDEX_NONE)
 		{
-			if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-				KeyPropertyDescriptor->Identical(Data, InKey))
+			for (auto It = AddedKeyIndexes.CreateConstKeyIterator(KeyHash); It; ++It)
 			{
-				KeyIndex = Index;
+				if (KeyPropertyDescriptor->Identical(ScriptMap->GetData(It.Value(), ScriptMapLayout), Key))
+				{
+					KeyIndex = It.Value();
 
-				break;
+					break;
+				}
 			}
 		}
-	}
 
-	uint8* Data;
+		uint8* Data;
 
-	if (KeyIndex == INDEX_NONE)
-	{
-		KeyIndex = ScriptMap->AddUninitialized(ScriptMapLayout);
+		if (KeyIndex == INDEX_NONE)
+		{
+			KeyIndex = ScriptMap->AddUninitialized(ScriptMapLayout);
 
-		Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
+			Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
 
-		KeyPropertyDescriptor->Set(InKey, Data);
+			KeyPropertyDescriptor->Set(Key, Data);
 
+			AddedKeyIndexes.Add(KeyHash, KeyIndex);
+		}
+		else
+		{
+			Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
+
+			ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
+		}
+
+		ValuePropertyDescriptor->Set(Value, Data + ScriptMapLayout.ValueOffset);
+	}
+
+	if (AddedKeyIndexes.Num() > 0)
+	{
 #if STD_CPP_20
 		ScriptMap->Rehash(ScriptMapLayout, [=, this](const void* Src)
 #else
@@ -208,14 +274,6 @@ void FMapHelper::Set(void* InKey, void* InValue) const
 			                  return KeyPropertyDescriptor->GetValueTypeHash(Src);
 		                  });
 	}
-	else
-	{
-		Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
-
-		ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
-	}
-
-	ValuePropertyDescriptor->Set(InValue, Data + ScriptMapLayout.ValueOffset);
 }
 
 FPropertyDescriptor* FMapHelper::GetKeyPropertyDescriptor() const
@@ -256,3 +314,67 @@ void* FMapHelper::GetEnumeratorValue(const int32 InIndex) const
 		       ? static_cast<uint8*>(ScriptMap->GetData(InIndex, ScriptMapLayout)) + ScriptMapLayout.ValueOffset
 		       : nullptr;
 }
+
+bool FMapHelper::IsBlittable(const int32 InKeyTypeSize, const int32 InValueTypeSize) const
+{
+	// Only pairs that are passed raw across the boundary share their layout with the managed side
+	return KeyPropertyDescriptor->IsPrimitiveProperty() && KeyPropertyDescriptor->GetElementSize() == InKeyTypeSize &&
+		ValuePropertyDescriptor->IsPrimitiveProperty() && ValuePropertyDescriptor->GetElementSize() == InValueTypeSize;
+}
+
+int32 FMapHelper::Enumerate(int32& InOutIndex, void* OutKeyBuffer, void* OutValueBuffer, const int32 InCount,
+                            const int32 InKeyTypeSize, const int32 InValueTypeSize) const
+{
+	// Type sizes are only passed for chunks, which the managed side reads back as arrays of its key and value types
+	if ((InKeyTypeSize > 0 || InValueTypeSize > 0) && !IsBlittable(InKeyTypeSize, InValueTypeSize))
+	{
+		return INDEX_NONE;
+	}
+
+	const auto KeyBufferSize = KeyPropertyDescriptor->GetBufferSize();
+
+	const auto ValueBufferSize = ValuePropertyDescriptor->GetBufferSize();
+
+	auto Count = 0;
+
+	// Holes in the sparse array are skipped here instead of costing the managed side a call each
+	for (; Count < InCount && InOutIndex < ScriptMap->GetMaxIndex(); ++InOutIndex)
+	{
+		if (ScriptMap->IsValidIndex(InOutIndex))
+		{
+			const auto Data = static_cast<uint8*>(ScriptMap->GetData(InOutIndex, ScriptMapLayout));
+
+			KeyPropertyDescriptor->Get(Data,
+			                           reinterpret_cast<void**>(static_cast<uint8*>(OutKeyBuffer) + Count *
+				                           KeyBufferSize));
+
+			ValuePropertyDescriptor->Get(Data + ScriptMapLayout.ValueOffset,
+			                             reinterpret_cast<void**>(static_cast<uint8*>(OutValueBuffer) + Count *
+				                             ValueBufferSize));
+
+			++Count;
+		}
+	}
+
+	return Count;
+}
+
+int32 FMapHelper::FindPairIndex(const void* InKey) const
+{
+	return ScriptMap->Num() > 0
+		       ? FindPairIndex(InKey, KeyPropertyDescriptor->GetBufferValueTypeHash(InKey))
+		       : static_cast<int32>(INDEX_NONE);
+}
+
+int32 FMapHelper::FindPairIndex(const void* InKey, const uint32 InKeyHash) const
+{
+	return ScriptMap->FindPairIndex(InKey, ScriptMapLayout,
+	                                [InKeyHash](const void*)
+	                                {
+		                                return InKeyHash;
+	                                },
+	                                [this](const void* InA, const void* InB)
+	                                {
+		                                return KeyPropertyDescriptor->Identical(InB, InA);
+	                                });
+}
@@ -45,9 +45,12 @@ void FSetHelper::Deinitialize()
 		ScriptSet = nullptr;
 	}
 
-	if (bNeedFreeProperty && ElementPropertyDescriptor != nullptr)
+	if (ElementPropertyDescriptor != nullptr)
 	{
-		ElementPropertyDescriptor->DestroyProperty();
+		if (bNeedFreeProperty)
+		{
+			ElementPropertyDescriptor->DestroyProperty();
+		}
 
 		delete ElementPropertyDescriptor;
 
@@ -77,30 +80,98 @@ int32 FSetHelper::GetMaxIndex() const
 
 void FSetHelper::Add(void* InValue) const
 {
-	auto ValueIndex = static_cast<int32>(INDEX_NONE);
+	auto Value = InValue;
+
+	if (!ElementPropertyDescriptor->IsPrimitiveProperty())
+	{
+		Value = FMemory_Alloca_Aligned(ElementPropertyDescriptor->GetSize(),
+		                               ElementPropertyDescriptor->GetMinAlignment());
+
+		FMemory::Memzero(Value, ElementPropertyDescriptor->GetSize());
+
+		ElementPropertyDescriptor->Set(InValue, Value);
+	}
+
+	ScriptSet->Add(Value, ScriptSetLayout,
+	               [this](const void* InElement)
+	               {
+		               return ElementPropertyDescriptor->GetValueTypeHash(InElement);
+	               },
+	               [this](const void* InA, const void* InB)
+	               {
+		               return ElementPropertyDescriptor->GetProperty()->Identical(InA, InB);
+	               },
+	               [this, InValue](void* InNewElement)
+	               {
+		               ElementPropertyDescriptor->Set(InValue, InNewElement);
+	               },
+	               [this](void* InElement)
+	               {
+		               ElementPropertyDescriptor->DestroyValue(InElement);
+	               });
+
+	if (Value != InValue)
+	{
+		ElementPropertyDescriptor->DestroyValue(Value);
+	}
+}
+
+void FSetHelper::Append(const int32 InNum, uint8* InValues) const
+{
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	const auto ValueBufferSize = ElementPropertyDescriptor->GetBufferSize();
+
+	// FScriptSet has no Reserve, an empty set can take the slack through Empty
+	if (ScriptSet->Num() == 0)
+	{
+		ScriptSet->Empty(InNum, ScriptSetLayout);
+	}
+
+	// Only elements from before the batch are linked into the hash, an empty set has no hash to probe at all
+	const auto bHasHash = ScriptSet->Num() > 0;
+
+	// Elements added by this batch are not linked into the hash until the final rehash
+	TMultiMap<uint32, int32> AddedValueIndexes;
 
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
+	for (auto Index = 0; Index < InNum; ++Index)
 	{
-		if (ScriptSet->IsValidIndex(Index))
+		const auto Value = InValues + Index * ValueBufferSize;
+
+		const auto ValueHash = ElementPropertyDescriptor->GetBufferValueTypeHash(Value);
+
+		if (bHasHash && FindIndex(Value, ValueHash) != INDEX_NONE)
+		{
+			continue;
+		}
+
+		auto bIsAdded = false;
+
+		for (auto It = AddedValueIndexes.CreateConstKeyIterator(ValueHash); It; ++It)
 		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
+			if (ElementPropertyDescriptor->Identical(ScriptSet->GetData(It.Value(), ScriptSetLayout), Value))
 			{
-				ValueIndex = Index;
+				bIsAdded = true;
 
 				break;
 			}
 		}
-	}
 
-	if (ValueIndex == INDEX_NONE)
-	{
-		ValueIndex = ScriptSet->AddUninitialized(ScriptSetLayout);
+		if (!bIsAdded)
+		{
+			const auto ValueIndex = ScriptSet->AddUninitialized(ScriptSetLayout);
 
-		const auto Data = static_cast<uint8*>(ScriptSet->GetData(ValueIndex, ScriptSetLayout));
+			ElementPropertyDescriptor->Set(Value, ScriptSet->GetData(ValueIndex, ScriptSetLayout));
 
-		ElementPropertyDescriptor->Set(InValue, Data);
+			AddedValueIndexes.Add(ValueHash, ValueIndex);
+		}
+	}
 
+	if (AddedValueIndexes.Num() > 0)
+	{
 #if STD_CPP_20
 		ScriptSet->Rehash(ScriptSetLayout, [=, this](const void* Src)
 #else
@@ -114,21 +185,7 @@ void FSetHelper::Add(void* InValue) const
 
 int32 FSetHelper::Remove(const void* InValue) const
 {
-	auto ValueIndex = static_cast<int32>(INDEX_NONE);
-
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
-	{
-		if (ScriptSet->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
-			{
-				ValueIndex = Index;
-
-				break;
-			}
-		}
-	}
+	const auto ValueIndex = FindIndex(InValue);
 
 	if (ValueIndex == INDEX_NONE)
 	{
@@ -146,19 +203,7 @@ int32 FSetHelper::Remove(const void* InValue) const
 
 bool FSetHelper::Contains(const void* InValue) const
 {
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
-	{
-		if (ScriptSet->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
+	return FindIndex(InValue) != INDEX_NONE;
 }
 
 FPropertyDescriptor* FSetHelper::GetElementPropertyDescriptor() const
@@ -182,3 +227,55 @@ void* FSetHelper::GetEnumerator(const int32 InIndex) const
 		       ? static_cast<uint8*>(ScriptSet->GetData(InIndex, ScriptSetLayout))
 		       : nullptr;
 }
+
+bool FSetHelper::IsBlittable(const int32 InTypeSize) const
+{
+	// Only elements that are passed raw across the boundary share their layout with the managed side
+	return ElementPropertyDescriptor->IsPrimitiveProperty() && ElementPropertyDescriptor->GetElementSize() == InTypeSize;
+}
+
+int32 FSetHelper::Enumerate(int32& InOutIndex, void* OutBuffer, const int32 InCount, const int32 InTypeSize) const
+{
+	// A type size is only passed for chunks, which the managed side reads back as an array of its element type
+	if (InTypeSize > 0 && !IsBlittable(InTypeSize))
+	{
+		return INDEX_NONE;
+	}
+
+	const auto BufferSize = ElementPropertyDescriptor->GetBufferSize();
+
+	auto Count = 0;
+
+	// Holes in the sparse array are skipped here instead of costing the managed side a call each
+	for (; Count < InCount && InOutIndex < ScriptSet->GetMaxIndex(); ++InOutIndex)
+	{
+		if (ScriptSet->IsValidIndex(InOutIndex))
+		{
+			ElementPropertyDescriptor->Get(ScriptSet->GetData(InOutIndex, ScriptSetLayout),
+			                               reinterpret_cast<void**>(static_cast<uint8*>(OutBuffer) + Count++ *
+				                               BufferSize));
+		}
+	}
+
+	return Count;
+}
+
+int32 FSetHelper::FindIndex(const void* InValue) const
+{
+	return ScriptSet->Num() > 0
+		       ? FindIndex(InValue, ElementPropertyDescriptor->GetBufferValueTypeHash(InValue))
+		       : static_cast<int32>(INDEX_NONE);
+}
+
+int32 FSetHelper::FindIndex(const void* InValue, const uint32 InValueHash) const
+{
+	return ScriptSet->FindIndex(InValue, ScriptSetLayout,
+	                            [InValueHash](const void*)
+	                            {
+		                            return InValueHash;
+	                            },
+	                            [this](const void* InA, const void* InB)
+	                            {
+		                            return ElementPropertyDescriptor->Identical(InB, InA);
+	                            });
+}
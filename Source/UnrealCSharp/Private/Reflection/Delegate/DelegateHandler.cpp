@@ -3,7 +3,9 @@
 
 void UDelegateHandler::ProcessEvent(UFunction* Function, void* Parms)
 {
-	if (Function != nullptr && Function->GetName() == FUNCTION_CSHARP_CALLBACK)
+	static const FName CSharpCallBackName(*FUNCTION_CSHARP_CALLBACK);
+
+	if (Function != nullptr && Function->GetFName() == CSharpCallBackName)
 	{
 		if (DelegateDescriptor != nullptr)
 		{
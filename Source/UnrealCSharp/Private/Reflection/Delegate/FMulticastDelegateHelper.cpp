@@ -1,5 +1,7 @@
 ﻿#include "Reflection/Delegate/FMulticastDelegateHelper.h"
 
+TArray<UMulticastDelegateHandler*> FMulticastDelegateHelper::HandlerPool;
+
 FMulticastDelegateHelper::FMulticastDelegateHelper()
 {
 	Initialize(nullptr, nullptr);
@@ -18,9 +20,7 @@ FMulticastDelegateHelper::~FMulticastDelegateHelper()
 
 void FMulticastDelegateHelper::Initialize(FMulticastScriptDelegate* InMulticastDelegate, UFunction* InSignatureFunction)
 {
-	MulticastDelegateHandler = NewObject<UMulticastDelegateHandler>();
-
-	MulticastDelegateHandler->AddToRoot();
+	MulticastDelegateHandler = AcquireHandler();
 
 	MulticastDelegateHandler->Initialize(InMulticastDelegate,
 	                                     InSignatureFunction != nullptr
@@ -32,9 +32,18 @@ void FMulticastDelegateHelper::Deinitialize()
 {
 	if (MulticastDelegateHandler != nullptr)
 	{
+		const auto bIsRecyclable = MulticastDelegateHandler->IsRecyclable();
+
 		MulticastDelegateHandler->Deinitialize();
 
-		MulticastDelegateHandler->RemoveFromRoot();
+		if (bIsRecyclable)
+		{
+			ReleaseHandler(MulticastDelegateHandler.Get());
+		}
+		else
+		{
+			MulticastDelegateHandler->RemoveFromRoot();
+		}
 
 		MulticastDelegateHandler = nullptr;
 	}
@@ -99,3 +108,42 @@ FName FMulticastDelegateHelper::GetFunctionName() const
 {
 	return MulticastDelegateHandler != nullptr ? MulticastDelegateHandler->GetFunctionName() : NAME_None;
 }
+
+void FMulticastDelegateHelper::EmptyHandlerPool()
+{
+	for (const auto MulticastDelegateHandler : HandlerPool)
+	{
+		if (IsValid(MulticastDelegateHandler))
+		{
+			MulticastDelegateHandler->RemoveFromRoot();
+		}
+	}
+
+	HandlerPool.Empty();
+}
+
+UMulticastDelegateHandler* FMulticastDelegateHelper::AcquireHandler()
+{
+	if (!HandlerPool.IsEmpty())
+	{
+		return HandlerPool.Pop();
+	}
+
+	const auto NewMulticastDelegateHandler = NewObject<UMulticastDelegateHandler>();
+
+	NewMulticastDelegateHandler->AddToRoot();
+
+	return NewMulticastDelegateHandler;
+}
+
+void FMulticastDelegateHelper::ReleaseHandler(UMulticastDelegateHandler* InMulticastDelegateHandler)
+{
+	if (HandlerPool.Num() < MaxHandlerPoolSize)
+	{
+		HandlerPool.Push(InMulticastDelegateHandler);
+	}
+	else
+	{
+		InMulticastDelegateHandler->RemoveFromRoot();
+	}
+}
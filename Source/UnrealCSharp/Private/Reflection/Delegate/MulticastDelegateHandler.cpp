@@ -5,7 +5,9 @@
 
 void UMulticastDelegateHandler::ProcessEvent(UFunction* Function, void* Parms)
 {
-	if (Function != nullptr && Function->GetName() == FUNCTION_CSHARP_CALLBACK)
+	static const FName CSharpCallBackName(*FUNCTION_CSHARP_CALLBACK);
+
+	if (Function != nullptr && Function->GetFName() == CSharpCallBackName)
 	{
 		if (DelegateDescriptor != nullptr)
 		{
@@ -30,6 +32,8 @@ void UMulticastDelegateHandler::Initialize(FMulticastScriptDelegate* InMulticast
 {
 	bNeedFree = InMulticastScriptDelegate == nullptr;
 
+	bIsExposed = false;
+
 	MulticastScriptDelegate = InMulticastScriptDelegate != nullptr
 		                          ? InMulticastScriptDelegate
 		                          : new FMulticastScriptDelegate();
@@ -154,6 +158,8 @@ void UMulticastDelegateHandler::Clear()
 
 UObject* UMulticastDelegateHandler::GetUObject() const
 {
+	bIsExposed = true;
+
 	return const_cast<UObject*>(ScriptDelegate.GetUObject());
 }
 
@@ -166,3 +172,9 @@ UFunction* UMulticastDelegateHandler::GetCallBack() const
 {
 	return FindFunction(*FUNCTION_CSHARP_CALLBACK);
 }
+
+bool UMulticastDelegateHandler::IsRecyclable() const
+{
+	// An external delegate may already be destroyed when we are released, so it is never touched here
+	return !bIsExposed && (bNeedFree || !ScriptDelegate.IsBound());
+}
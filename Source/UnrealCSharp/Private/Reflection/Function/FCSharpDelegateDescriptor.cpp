@@ -4,7 +4,7 @@
 
 FCSharpDelegateDescriptor::FCSharpDelegateDescriptor(UFunction* InFunction):
 	Super(InFunction,
-	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamPersistentBufferAllocator>(InFunction))
+	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamStackBufferAllocator>(InFunction))
 {
 }
 
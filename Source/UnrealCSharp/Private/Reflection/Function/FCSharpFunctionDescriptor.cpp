@@ -4,13 +4,17 @@
 
 FCSharpFunctionDescriptor::FCSharpFunctionDescriptor(const FString& InMethodName, UFunction* InFunction):
 	Super(InFunction,
-	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamPoolBufferAllocator>(InFunction)),
+	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamStackBufferAllocator>(InFunction)),
 	OriginalFunctionFlags(EFunctionFlags::FUNC_None),
 	OriginalNativeFuncPtr(nullptr),
 	Method(FCSharpEnvironment::GetEnvironment().GetDomain()->Parent_Class_Get_Method_From_Name(
 		FCSharpEnvironment::GetEnvironment().GetClassDescriptor(InFunction->GetOwnerClass())->GetMonoClass(),
-		InMethodName, PropertyDescriptors.Num()))
+		InMethodName, PropertyDescriptors.Num())),
+	Thunk(nullptr),
+	ThunkInvoker(nullptr),
+	bIsThunkInstance(false)
 {
+	InitializeThunk();
 }
 
 FCSharpFunctionDescriptor::~FCSharpFunctionDescriptor()
@@ -80,8 +84,6 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 			     *InStack.Code != EX_EndFunctionParms;
 			     Property = static_cast<FProperty*>(Property->Next))
 			{
-				Property->InitializeValue_InContainer(Params);
-
 				InStack.MostRecentPropertyAddress = nullptr;
 
 				if (Property->HasAnyPropertyFlags(CPF_OutParm))
@@ -125,33 +127,218 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 		}
 	}
 
-	auto OutParams = NewOutParams != nullptr ? NewOutParams : InStack.OutParms;
+	const auto OutParams = NewOutParams != nullptr ? NewOutParams : InStack.OutParms;
 
-	const auto CSharpParams = FCSharpEnvironment::GetEnvironment().GetDomain()->Array_New(
-		FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Object_Class(), PropertyDescriptors.Num());
+	const auto FoundMonoObject = OriginalFunctionFlags & FUNC_Static
+		                             ? nullptr
+		                             : FCSharpEnvironment::GetEnvironment().GetObject(InContext);
+
+	if (ThunkInvoker != nullptr)
+	{
+		CallThunk(FoundMonoObject, Params, OutParams, RESULT_PARAM);
+	}
+	else
+	{
+		CallRuntimeInvoke(FoundMonoObject, Params, OutParams, RESULT_PARAM);
+	}
+
+	if (Params != nullptr && Params != InStack.Locals)
+	{
+		for (auto DestructorLink = Function->DestructorLink;
+		     DestructorLink != nullptr;
+		     DestructorLink = DestructorLink->DestructorLinkNext)
+		{
+			if (!DestructorLink->HasAnyPropertyFlags(CPF_OutParm))
+			{
+				DestructorLink->DestroyValue_InContainer(Params);
+			}
+		}
+
+		BufferAllocator->Free(Params);
+	}
+
+	return true;
+}
+
+void FCSharpFunctionDescriptor::InitializeThunk()
+{
+	if (Method == nullptr || !FCSharpFunctionThunk::IsSupported())
+	{
+		return;
+	}
+
+	const auto Domain = FCSharpEnvironment::GetEnvironment().GetDomain();
+
+	const auto Signature = Domain->Method_Signature(Method);
+
+	if (Signature == nullptr)
+	{
+		return;
+	}
+
+	bIsThunkInstance = !!Domain->Signature_Is_Instance(Signature);
+
+	const auto ArgumentCount = PropertyDescriptors.Num() + (bIsThunkInstance ? 1 : 0);
+
+	if (ArgumentCount > FCSharpFunctionThunk::MaxArgumentCount)
+	{
+		return;
+	}
+
+	ThunkParams.SetNum(PropertyDescriptors.Num());
+
+	auto FloatingMask = 0u;
 
-	auto ReferenceParam = OutParams;
+	void* Iterator = nullptr;
 
 	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
 	{
-		void* PropertyAddress{};
+		if (!FCSharpFunctionThunk::GetParam(PropertyDescriptors[Index]->GetProperty(),
+		                                    PropertyDescriptors[Index]->IsPrimitiveProperty(),
+		                                    Domain->Signature_Get_Params(Signature, &Iterator),
+		                                    ThunkParams[Index]))
+		{
+			ThunkParams.Empty();
+
+			return;
+		}
+
+		if (ThunkParams[Index].Type == ECSharpFunctionThunkType::Floating && !ThunkParams[Index].bIsByRef)
+		{
+			FloatingMask |= 1u << (Index + (bIsThunkInstance ? 1 : 0));
+		}
+	}
+
+	if (ReturnPropertyDescriptor != nullptr)
+	{
+		if (!FCSharpFunctionThunk::GetParam(ReturnPropertyDescriptor->GetProperty(),
+		                                    ReturnPropertyDescriptor->IsPrimitiveProperty(),
+		                                    Domain->Signature_Get_Return_Type(Signature),
+		                                    ReturnThunkParam) || ReturnThunkParam.bIsByRef)
+		{
+			ThunkParams.Empty();
+
+			return;
+		}
+	}
+
+	Thunk = Domain->Method_Get_Unmanaged_Thunk(Method);
+
+	if (Thunk != nullptr)
+	{
+		ThunkInvoker = FCSharpFunctionThunk::GetInvoker(ReturnThunkParam.Type, ArgumentCount, FloatingMask);
+	}
+}
+
+void FCSharpFunctionDescriptor::CallThunk(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams,
+                                          RESULT_DECL) const
+{
+	uint64 Arguments[FCSharpFunctionThunk::MaxArgumentCount]{};
+
+	uint64 Values[FCSharpFunctionThunk::MaxArgumentCount]{};
+
+	auto ArgumentIndex = 0;
+
+	if (bIsThunkInstance)
+	{
+		Arguments[ArgumentIndex++] = reinterpret_cast<UPTRINT>(InMonoObject);
+	}
+
+	auto ReferenceParam = InOutParams;
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index, ++ArgumentIndex)
+	{
+		const auto& ThunkParam = ThunkParams[Index];
 
-		if (ReferencePropertyIndexes.Contains(Index))
+		if (const auto PropertyAddress = GetPropertyAddress(Index, InParams, ReferenceParam))
 		{
-			if (const auto ReferencePropertyDescriptor = PropertyDescriptors[Index])
+			if (ThunkParam.Type == ECSharpFunctionThunkType::Object)
 			{
-				ReferenceParam = FindOutParmRec(ReferenceParam, ReferencePropertyDescriptor->GetProperty());
+				void* Object = nullptr;
 
-				if (ReferenceParam != nullptr)
-				{
-					PropertyAddress = ReferenceParam->PropAddr;
-				}
+				PropertyDescriptors[Index]->Get<std::false_type>(PropertyAddress, &Object);
+
+				Values[Index] = reinterpret_cast<UPTRINT>(Object);
+			}
+			else
+			{
+				PropertyDescriptors[Index]->Get(PropertyAddress, static_cast<void*>(&Values[Index]));
+
+				Values[Index] = FCSharpFunctionThunk::ToArgument(ThunkParam, Values[Index]);
 			}
 		}
-		else
+
+		Arguments[ArgumentIndex] = ThunkParam.bIsByRef ? reinterpret_cast<UPTRINT>(&Values[Index]) : Values[Index];
+	}
+
+	MonoObject* Exception = nullptr;
+
+	auto ReturnValue = ThunkInvoker(Thunk, Arguments, &Exception);
+
+	if (Exception != nullptr)
+	{
+		FCSharpEnvironment::GetEnvironment().GetDomain()->Unhandled_Exception(Exception);
+
+		return;
+	}
+
+	if (ReturnPropertyDescriptor != nullptr)
+	{
+		if (ReturnThunkParam.Type != ECSharpFunctionThunkType::Object)
+		{
+			ReturnPropertyDescriptor->Set(&ReturnValue, RESULT_PARAM);
+		}
+		else if (ReturnValue != 0)
+		{
+			ReturnPropertyDescriptor->Set(
+				FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
+					reinterpret_cast<MonoObject*>(ReturnValue)),
+				RESULT_PARAM);
+		}
+	}
+
+	auto OutParams = InOutParams;
+
+	for (const auto& Index : OutPropertyIndexes)
+	{
+		if (!ThunkParams[Index].bIsByRef)
 		{
-			PropertyAddress = PropertyDescriptors[Index]->ContainerPtrToValuePtr<void>(Params);
+			continue;
+		}
+
+		if (const auto OutPropertyDescriptor = PropertyDescriptors[Index])
+		{
+			OutParams = FindOutParmRec(OutParams, OutPropertyDescriptor->GetProperty());
+
+			if (OutParams != nullptr)
+			{
+				if (ThunkParams[Index].Type != ECSharpFunctionThunkType::Object)
+				{
+					OutPropertyDescriptor->Set(&Values[Index], OutParams->PropAddr);
+				}
+				else if (Values[Index] != 0)
+				{
+					OutPropertyDescriptor->Set(
+						FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
+							reinterpret_cast<MonoObject*>(Values[Index])),
+						OutParams->PropAddr);
+				}
+			}
 		}
+	}
+}
+
+void FCSharpFunctionDescriptor::CallRuntimeInvoke(MonoObject* InMonoObject, void* InParams,
+                                                  FOutParmRec* InOutParams, RESULT_DECL) const
+{
+	const auto CSharpParams = FCSharpEnvironment::GetEnvironment().GetDomain()->Array_New(
+		FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Object_Class(), PropertyDescriptors.Num());
+
+	auto ReferenceParam = InOutParams;
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	{
+		const auto PropertyAddress = GetPropertyAddress(Index, InParams, ReferenceParam);
 
 		void* Object = nullptr;
 
@@ -160,12 +347,8 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 		ARRAY_SET(CSharpParams, MonoObject*, Index, static_cast<MonoObject*>(Object));
 	}
 
-	const auto FoundMonoObject = OriginalFunctionFlags & FUNC_Static
-		                             ? nullptr
-		                             : FCSharpEnvironment::GetEnvironment().GetObject(InContext);
-
 	if (const auto ReturnValue = FCSharpEnvironment::GetEnvironment().GetDomain()->Runtime_Invoke_Array(
-			Method, FoundMonoObject, CSharpParams);
+			Method, InMonoObject, CSharpParams);
 		ReturnValue != nullptr && ReturnPropertyDescriptor != nullptr)
 	{
 		if (ReturnPropertyDescriptor->IsPrimitiveProperty())
@@ -184,6 +367,8 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 		}
 	}
 
+	auto OutParams = InOutParams;
+
 	for (const auto& Index : OutPropertyIndexes)
 	{
 		if (const auto OutPropertyDescriptor = PropertyDescriptors[Index])
@@ -210,23 +395,27 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 			}
 		}
 	}
+}
 
-	if (Params != nullptr && Params != InStack.Locals)
+void* FCSharpFunctionDescriptor::GetPropertyAddress(const int32 InIndex, void* InParams,
+                                                    FOutParmRec*& InOutParams) const
+{
+	if (ReferencePropertyIndexes.Contains(InIndex))
 	{
-		for (auto DestructorLink = Function->DestructorLink;
-		     DestructorLink != nullptr;
-		     DestructorLink = DestructorLink->DestructorLinkNext)
+		if (const auto ReferencePropertyDescriptor = PropertyDescriptors[InIndex])
 		{
-			if (!DestructorLink->HasAnyPropertyFlags(CPF_OutParm))
+			InOutParams = FindOutParmRec(InOutParams, ReferencePropertyDescriptor->GetProperty());
+
+			if (InOutParams != nullptr)
 			{
-				DestructorLink->DestroyValue_InContainer(Params);
+				return InOutParams->PropAddr;
 			}
 		}
 
-		BufferAllocator->Free(Params);
+		return nullptr;
 	}
 
-	return true;
+	return PropertyDescriptors[InIndex]->ContainerPtrToValuePtr<void>(InParams);
 }
 
 FOutParmRec* FCSharpFunctionDescriptor::FindOutParmRec(FOutParmRec* OutParam, const FProperty* OutProperty)
@@ -0,0 +1,187 @@
+﻿#include "Reflection/Function/FCSharpFunctionThunk.h"
+#include "Domain/FDomain.h"
+#include "UEVersion.h"
+
+namespace
+{
+	constexpr auto InvokerCount = (1u << (FCSharpFunctionThunk::MaxArgumentCount + 1)) - 1;
+
+	constexpr uint32 GetArgumentCount(const uint32 InEntry)
+	{
+		uint32 ArgumentCount = 0;
+
+		while ((2u << ArgumentCount) <= InEntry + 1)
+		{
+			++ArgumentCount;
+		}
+
+		return ArgumentCount;
+	}
+
+	constexpr uint32 GetFloatingMask(const uint32 InEntry)
+	{
+		return InEntry + 1 - (1u << GetArgumentCount(InEntry));
+	}
+
+	template <uint32 FloatingMask, SIZE_T Index>
+	using TArgument = std::conditional_t<(FloatingMask & (1u << Index)) != 0, double, uint64>;
+
+	template <typename T>
+	T ToArgument(const uint64 InValue)
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			double Value;
+
+			FMemory::Memcpy(&Value, &InValue, sizeof(double));
+
+			return Value;
+		}
+		else
+		{
+			return InValue;
+		}
+	}
+
+	template <typename ReturnType, uint32 FloatingMask, SIZE_T... Index>
+	uint64 InvokeImplementation(void* InThunk, const uint64* InArguments, MonoObject** OutException,
+	                            std::index_sequence<Index...>)
+	{
+		using ThunkType = ReturnType(*)(TArgument<FloatingMask, Index>..., MonoObject**);
+
+		if constexpr (std::is_void_v<ReturnType>)
+		{
+			reinterpret_cast<ThunkType>(InThunk)(
+				ToArgument<TArgument<FloatingMask, Index>>(InArguments[Index])..., OutException);
+
+			return 0;
+		}
+		else
+		{
+			const ReturnType ReturnValue = reinterpret_cast<ThunkType>(InThunk)(
+				ToArgument<TArgument<FloatingMask, Index>>(InArguments[Index])..., OutException);
+
+			uint64 Value;
+
+			FMemory::Memcpy(&Value, &ReturnValue, sizeof(uint64));
+
+			return Value;
+		}
+	}
+
+	template <typename ReturnType, uint32 Entry>
+	uint64 Invoke(void* InThunk, const uint64* InArguments, MonoObject** OutException)
+	{
+		return InvokeImplementation<ReturnType, GetFloatingMask(Entry)>(
+			InThunk, InArguments, OutException, std::make_index_sequence<GetArgumentCount(Entry)>());
+	}
+
+	template <typename ReturnType, uint32... Entry>
+	FCSharpFunctionThunk::InvokerType GetInvoker(const uint32 InEntry, std::integer_sequence<uint32, Entry...>)
+	{
+		static constexpr FCSharpFunctionThunk::InvokerType Invokers[] = {&Invoke<ReturnType, Entry>...};
+
+		return Invokers[InEntry];
+	}
+}
+
+bool FCSharpFunctionThunk::IsSupported()
+{
+	return PLATFORM_64BITS && PLATFORM_LITTLE_ENDIAN;
+}
+
+FCSharpFunctionThunk::InvokerType FCSharpFunctionThunk::GetInvoker(const ECSharpFunctionThunkType InReturnType,
+                                                                   const int32 InArgumentCount,
+                                                                   const uint32 InFloatingMask)
+{
+	if (!IsSupported() || InArgumentCount < 0 || InArgumentCount > MaxArgumentCount)
+	{
+		return nullptr;
+	}
+
+	const auto Entry = (1u << InArgumentCount) - 1 + InFloatingMask;
+
+	switch (InReturnType)
+	{
+	case ECSharpFunctionThunkType::Void:
+		return ::GetInvoker<void>(Entry, std::make_integer_sequence<uint32, InvokerCount>());
+	case ECSharpFunctionThunkType::Floating:
+		return ::GetInvoker<double>(Entry, std::make_integer_sequence<uint32, InvokerCount>());
+	default:
+		return ::GetInvoker<uint64>(Entry, std::make_integer_sequence<uint32, InvokerCount>());
+	}
+}
+
+bool FCSharpFunctionThunk::GetParam(FProperty* InProperty, const bool bIsPrimitive, MonoType* InMonoType,
+                                    FCSharpFunctionThunkParam& OutParam)
+{
+	if (InProperty == nullptr || InMonoType == nullptr)
+	{
+		return false;
+	}
+
+	OutParam.bIsByRef = !!FDomain::Type_Is_ByRef(InMonoType);
+
+	if (!bIsPrimitive)
+	{
+		if (!FDomain::Type_Is_Reference(InMonoType))
+		{
+			return false;
+		}
+
+		OutParam.Type = ECSharpFunctionThunkType::Object;
+
+		OutParam.Size = sizeof(MonoObject*);
+
+		return true;
+	}
+
+	if (FDomain::Type_Is_Reference(InMonoType))
+	{
+		return false;
+	}
+
+	if (const auto EnumProperty = CastField<FEnumProperty>(InProperty))
+	{
+		InProperty = EnumProperty->GetUnderlyingProperty();
+	}
+
+	if (InProperty->IsA<FFloatProperty>() || InProperty->IsA<FDoubleProperty>())
+	{
+		OutParam.Type = ECSharpFunctionThunkType::Floating;
+	}
+	else if (InProperty->IsA<FNumericProperty>() || InProperty->IsA<FBoolProperty>())
+	{
+		OutParam.Type = ECSharpFunctionThunkType::Integer;
+
+		OutParam.bIsSigned = InProperty->IsA<FInt8Property>() ||
+			InProperty->IsA<FInt16Property>() ||
+			InProperty->IsA<FIntProperty>() ||
+			InProperty->IsA<FInt64Property>();
+	}
+	else
+	{
+		return false;
+	}
+
+	OutParam.Size =
+#if UE_F_PROPERTY_GET_ELEMENT_SIZE
+		InProperty->GetElementSize();
+#else
+		InProperty->ElementSize;
+#endif
+
+	return OutParam.Size <= sizeof(uint64);
+}
+
+uint64 FCSharpFunctionThunk::ToArgument(const FCSharpFunctionThunkParam& InParam, const uint64 InValue)
+{
+	if (InParam.Type == ECSharpFunctionThunkType::Integer && InParam.bIsSigned && InParam.Size < sizeof(uint64))
+	{
+		const auto Shift = (sizeof(uint64) - InParam.Size) * 8;
+
+		return static_cast<uint64>(static_cast<int64>(InValue << Shift) >> Shift);
+	}
+
+	return InValue;
+}
@@ -5,6 +5,7 @@ FFunctionDescriptor::FFunctionDescriptor(UFunction* InFunction,
                                          const TSharedPtr<FFunctionParamBufferAllocator>& InBufferAllocator):
 	Function(InFunction),
 	ReturnPropertyDescriptor(nullptr),
+	ReturnOffset(0),
 	BufferAllocator(InBufferAllocator)
 {
 	FFunctionDescriptor::Initialize();
@@ -41,22 +42,46 @@ void FFunctionDescriptor::Initialize()
 			{
 				ReturnPropertyDescriptor = PropertyDescriptor;
 
+				ReturnOffset = Property->GetOffset_ForUFunction();
+
 				continue;
 			}
 
 			const auto Index = PropertyDescriptors.Add(PropertyDescriptor);
 
+			auto bIsReferenceIn = true;
+
 			if (Property->HasAnyPropertyFlags(CPF_OutParm) && !Property->HasAnyPropertyFlags(CPF_ConstParm))
 			{
 				if (IsNativeFunction || Property->HasAnyPropertyFlags(CPF_ReferenceParm))
 				{
 					ReferencePropertyIndexes.Emplace(Index);
 				}
+				else
+				{
+					bIsReferenceIn = false;
+				}
 
 				OutPropertyIndexes.Emplace(Index);
 			}
+
+			ParamPlans.Add({
+				PropertyDescriptor,
+				Property,
+				Property->GetOffset_ForUFunction(),
+				PropertyDescriptor->GetBufferSize(),
+				PropertyDescriptor->IsPrimitiveProperty(),
+				bIsReferenceIn
+			});
 		}
 	}
+
+	OutParamPlans.Reserve(OutPropertyIndexes.Num());
+
+	for (const auto& Index : OutPropertyIndexes)
+	{
+		OutParamPlans.Add(ParamPlans[Index]);
+	}
 }
 
 void FFunctionDescriptor::Deinitialize()
@@ -77,8 +102,14 @@ void FFunctionDescriptor::Deinitialize()
 		ReturnPropertyDescriptor = nullptr;
 	}
 
+	ReferencePropertyIndexes.Empty();
+
 	OutPropertyIndexes.Empty();
 
+	ParamPlans.Empty();
+
+	OutParamPlans.Empty();
+
 	Function.Reset();
 }
 
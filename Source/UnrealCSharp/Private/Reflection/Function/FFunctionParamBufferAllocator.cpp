@@ -17,67 +17,95 @@ void FFunctionParamBufferAllocator::Free(void* InMemory)
 {
 }
 
-FFunctionParamPoolBufferAllocator::FFunctionParamPoolBufferAllocator(
-	const TWeakObjectPtr<UFunction>& InFunction):
-	Count(0),
-	ParamSize(InFunction->ParmsSize)
+FFunctionParamFrameStack::FFunctionParamFrameStack():
+	Current(0)
 {
 }
 
-FFunctionParamPoolBufferAllocator::~FFunctionParamPoolBufferAllocator()
+FFunctionParamFrameStack::~FFunctionParamFrameStack()
 {
-	for (const auto Buffer : Buffers)
+	for (const auto& Block : Blocks)
 	{
-		FMemory::Free(Buffer);
+		FMemory::Free(Block.Data);
 	}
 }
 
-void* FFunctionParamPoolBufferAllocator::Malloc()
+void* FFunctionParamFrameStack::Push(const int32 InSize)
 {
-	if (Buffers.IsValidIndex(Count))
+	const auto Size = Align(InSize, Alignment);
+
+	if (Blocks.IsValidIndex(Current) && Blocks[Current].Top + Size > Blocks[Current].Size)
 	{
-		return Buffers[Count++];
+		++Current;
 	}
 
-	Count++;
+	while (Blocks.IsValidIndex(Current) && Blocks[Current].Size < Size)
+	{
+		FMemory::Free(Blocks[Current].Data);
 
-	const auto Buffer = FMemory::Malloc(ParamSize, 16);
+		Blocks.RemoveAt(Current);
+	}
 
-	FMemory::Memzero(Buffer, ParamSize);
+	if (!Blocks.IsValidIndex(Current))
+	{
+		const auto NewBlockSize = FMath::Max(static_cast<int32>(BlockSize), Size);
+
+		Blocks.Insert({static_cast<uint8*>(FMemory::Malloc(NewBlockSize, Alignment)), NewBlockSize, 0}, Current);
+	}
 
-	Buffers.Add(Buffer);
+	auto& Block = Blocks[Current];
 
-	return Buffer;
-}
+	const auto Memory = Block.Data + Block.Top;
 
-void FFunctionParamPoolBufferAllocator::Free(void* InMemory)
-{
-	Count--;
+	Block.Top += Size;
+
+	return Memory;
 }
 
-FFunctionParamPersistentBufferAllocator::FFunctionParamPersistentBufferAllocator(
-	const TWeakObjectPtr<UFunction>& InFunction)
+void FFunctionParamFrameStack::Pop(void* InMemory)
 {
-	Params = FMemory::Malloc(InFunction->ParmsSize, 16);
+	auto& Block = Blocks[Current];
+
+	check(InMemory >= Block.Data && InMemory < Block.Data + Block.Top);
+
+	Block.Top = static_cast<int32>(static_cast<uint8*>(InMemory) - Block.Data);
 
-	FMemory::Memzero(Params, InFunction->ParmsSize);
+	if (Block.Top == 0 && Current > 0)
+	{
+		--Current;
+	}
 }
 
-FFunctionParamPersistentBufferAllocator::~FFunctionParamPersistentBufferAllocator()
+FFunctionParamStackBufferAllocator::FFunctionParamStackBufferAllocator(const TWeakObjectPtr<UFunction>& InFunction):
+	ParamSize(InFunction->ParmsSize)
 {
-	if (Params != nullptr)
+	for (TFieldIterator<FProperty> It(InFunction.Get()); It && (It->PropertyFlags & CPF_Parm); ++It)
 	{
-		FMemory::Free(Params);
-
-		Params = nullptr;
+		if (!It->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			NonZeroConstructorProperties.Add(*It);
+		}
 	}
 }
 
-void* FFunctionParamPersistentBufferAllocator::Malloc()
+void* FFunctionParamStackBufferAllocator::Malloc()
 {
-	return Params;
+	const auto Buffer = FFunctionParamFrameStack::Get().Push(ParamSize);
+
+	FMemory::Memzero(Buffer, ParamSize);
+
+	for (const auto Property : NonZeroConstructorProperties)
+	{
+		Property->InitializeValue_InContainer(Buffer);
+	}
+
+	return Buffer;
 }
 
-void FFunctionParamPersistentBufferAllocator::Free(void* InMemory)
+void FFunctionParamStackBufferAllocator::Free(void* InMemory)
 {
+	if (InMemory != nullptr)
+	{
+		FFunctionParamFrameStack::Get().Pop(InMemory);
+	}
 }
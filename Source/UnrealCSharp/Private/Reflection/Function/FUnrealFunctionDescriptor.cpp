@@ -1,7 +1,38 @@
 #include "Reflection/Function/FUnrealFunctionDescriptor.h"
+#include "Log/UnrealCSharpLog.h"
 
 FUnrealFunctionDescriptor::FUnrealFunctionDescriptor(UFunction* InFunction):
 	Super(InFunction,
-	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamPoolBufferAllocator>(InFunction))
+	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamStackBufferAllocator>(InFunction))
 {
+	if (InFunction->HasAnyFunctionFlags(FUNC_Static))
+	{
+		DefaultObject = InFunction->GetOuterUClass()->GetDefaultObject();
+	}
+}
+
+UObject* FUnrealFunctionDescriptor::GetDefaultObject() const
+{
+	if (const auto FoundDefaultObject = DefaultObject.Get())
+	{
+		return FoundDefaultObject;
+	}
+
+	if (Function.IsValid())
+	{
+		if (const auto Class = Function->GetOuterUClass())
+		{
+			DefaultObject = Class->GetDefaultObject();
+		}
+	}
+
+	if (const auto FoundDefaultObject = DefaultObject.Get())
+	{
+		return FoundDefaultObject;
+	}
+
+	UE_LOG(LogUnrealCSharp, Error, TEXT("Static function %s was not called, its class default object is invalid"),
+	       Function.IsValid() ? *Function->GetPathName() : TEXT("None"));
+
+	return nullptr;
 }
@@ -17,6 +17,7 @@
 #include "Reflection/Property/DelegateProperty/FDelegatePropertyDescriptor.h"
 #include "Reflection/Property/ObjectProperty/FInterfacePropertyDescriptor.h"
 #include "Reflection/Property/StructProperty/FStructPropertyDescriptor.h"
+#include "Reflection/Property/StructProperty/FBlittableStructPropertyDescriptor.h"
 #include "Reflection/Property/ContainerProperty/FArrayPropertyDescriptor.h"
 #include "Reflection/Property/EnumProperty/FEnumPropertyDescriptor.h"
 #include "Reflection/Property/StringProperty/FStrPropertyDescriptor.h"
@@ -32,6 +33,7 @@
 #include "Reflection/Property/ContainerProperty/FMapPropertyDescriptor.h"
 #include "Reflection/Property/ContainerProperty/FSetPropertyDescriptor.h"
 #include "Reflection/Property/FieldPathProperty/FFieldPathPropertyDescriptor.h"
+#include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "UEVersion.h"
 #if UE_F_OPTIONAL_PROPERTY
 #include "UObject/PropertyOptional.h"
@@ -80,7 +82,17 @@ FPropertyDescriptor* FPropertyDescriptor::Factory(FProperty* InProperty)
 
 	NEW_PROPERTY_DESCRIPTOR(FInterfaceProperty)
 
-	NEW_PROPERTY_DESCRIPTOR(FStructProperty)
+	if (const auto Property = CastField<FStructProperty>(InProperty))
+	{
+		if (FUnrealCSharpFunctionLibrary::IsBlittableStruct(Property->Struct))
+		{
+			return new FBlittableStructPropertyDescriptor(Property);
+		}
+		else
+		{
+			return new FStructPropertyDescriptor(Property);
+		}
+	}
 
 	NEW_PROPERTY_DESCRIPTOR(FArrayProperty)
 
@@ -176,6 +188,26 @@ void FPropertyDescriptor::DestroyValue(void* Dest) const
 	}
 }
 
+uint32 FPropertyDescriptor::GetBufferValueTypeHash(const void* InBuffer) const
+{
+	if (IsPrimitiveProperty())
+	{
+		return GetValueTypeHash(InBuffer);
+	}
+
+	const auto Value = FMemory_Alloca_Aligned(GetSize(), GetMinAlignment());
+
+	FMemory::Memzero(Value, GetSize());
+
+	Set(const_cast<void*>(InBuffer), Value);
+
+	const auto ValueTypeHash = GetValueTypeHash(Value);
+
+	DestroyValue(Value);
+
+	return ValueTypeHash;
+}
+
 bool FPropertyDescriptor::IsPrimitiveProperty() const
 {
 	return false;
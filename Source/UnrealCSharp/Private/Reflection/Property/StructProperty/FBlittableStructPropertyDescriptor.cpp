@@ -0,0 +1 @@
+﻿#include "Reflection/Property/StructProperty/FBlittableStructPropertyDescriptor.h"
@@ -18,6 +18,8 @@ void FStructPropertyDescriptor::Get(void* Src, void** Dest, std::true_type) cons
 
 void FStructPropertyDescriptor::Get(void* Src, void** Dest, std::false_type) const
 {
+	// Container elements move on reallocation and their addresses are reused after removal,
+	// a wrapper registered at the same address may belong to another owner, so it is never reused here
 	const auto Object = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(Class);
 
 	FCSharpEnvironment::GetEnvironment().AddStructReference<false>(Property->Struct, Src, Object);
@@ -34,6 +34,8 @@ void FClassRegistry::Deinitialize()
 			if (Key->ClassConstructor == &FClassRegistry::ClassConstructor)
 			{
 				Key->ClassConstructor = Value;
+
+				FDynamicClassGenerator::UpdateClassConstructor(Key.Get());
 			}
 		}
 	}
@@ -116,6 +118,8 @@ void FClassRegistry::AddClassConstructor(UClass* InClass)
 		ClassConstructorMap.Add(InClass, InClass->ClassConstructor);
 
 		InClass->ClassConstructor = &FClassRegistry::ClassConstructor;
+
+		FDynamicClassGenerator::UpdateClassConstructor(InClass);
 	}
 }
 
@@ -130,6 +134,8 @@ void FClassRegistry::RemoveClassDescriptor(const UStruct* InStruct)
 				Class->ClassConstructor = *FoundClassConstructor;
 
 				ClassConstructorMap.Remove(Class);
+
+				FDynamicClassGenerator::UpdateClassConstructor(Class);
 			}
 		}
 
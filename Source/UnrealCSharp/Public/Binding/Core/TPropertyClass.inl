@@ -15,6 +15,7 @@
 #include "Template/TIsNotUEnum.inl"
 #include "Template/TIsTEnumAsByte.inl"
 #include "UEVersion.h"
+#include <atomic>
 #if UE_F_OPTIONAL_PROPERTY
 #include "Template/TIsTOptional.inl"
 #endif
@@ -24,13 +25,75 @@ struct TPropertyClass
 {
 };
 
+// Resolved once per domain load instead of building and looking up the names on every access
+template <typename T, typename Resolver>
+struct TCachedPropertyClass
+{
+	static MonoClass* Get()
+	{
+		static std::atomic<MonoClass*> CachedMonoClass{};
+
+		static std::atomic<uint32> CachedGeneration{};
+
+		const auto Generation = FMonoDomain::Get_Class_Generation();
+
+		if (CachedGeneration.load(std::memory_order_acquire) == Generation)
+		{
+			return CachedMonoClass.load(std::memory_order_relaxed);
+		}
+
+		const auto FoundMonoClass = Resolver::Resolve();
+
+		if (FoundMonoClass != nullptr)
+		{
+			CachedMonoClass.store(FoundMonoClass, std::memory_order_relaxed);
+
+			CachedGeneration.store(Generation, std::memory_order_release);
+		}
+
+		return FoundMonoClass;
+	}
+};
+
+template <typename T>
+struct TNameResolver
+{
+	static MonoClass* Resolve()
+	{
+		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+	}
+};
+
+template <typename T>
+struct TGenericResolver
+{
+	static MonoClass* Resolve()
+	{
+		return FMonoDomain::Class_From_Name(TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+	}
+};
+
+template <typename T>
+struct TNamePropertyClass : TCachedPropertyClass<T, TNameResolver<T>>
+{
+};
+
+template <typename T>
+struct TGenericPropertyClass : TCachedPropertyClass<T, TGenericResolver<T>>
+{
+};
+
 template <typename T, typename Type = typename TTemplateTypeTraits<std::decay_t<T>>::Type>
 struct TMultiPropertyClass
 {
 	static auto Get()
 	{
-		const auto FoundGenericMonoClass = FMonoDomain::Class_From_Name(
-			TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+		return TCachedPropertyClass<T, TMultiPropertyClass>::Get();
+	}
+
+	static MonoClass* Resolve()
+	{
+		const auto FoundGenericMonoClass = TGenericPropertyClass<T>::Get();
 
 		const auto FoundMonoClass = TPropertyClass<Type, Type>::Get();
 
@@ -43,7 +106,7 @@ struct TBindingPropertyClass
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -52,7 +115,7 @@ struct TScriptStructPropertyClass
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -61,7 +124,7 @@ struct TBindingEnumPropertyClass
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -160,7 +223,7 @@ struct TPropertyClass<T, std::enable_if_t<std::is_base_of_v<UObject, std::remove
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -169,7 +232,7 @@ struct TPropertyClass<T, std::enable_if_t<TIsTObjectPtr<std::decay_t<T>>::Value,
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -178,7 +241,7 @@ struct TPropertyClass<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FName>
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -187,7 +250,7 @@ struct TPropertyClass<T, std::enable_if_t<TIsIInterface<std::decay_t<T>>::Value,
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -202,7 +265,7 @@ struct TPropertyClass<T, std::enable_if_t<TIsUStruct<std::decay_t<T>>::Value, T>
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -211,7 +274,7 @@ struct TPropertyClass<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FStrin
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -220,7 +283,7 @@ struct TPropertyClass<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FText>
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -256,8 +319,12 @@ struct TPropertyClass<T, std::enable_if_t<TIsTMap<std::decay_t<T>>::Value, T>>
 {
 	static auto Get()
 	{
-		const auto FoundGenericMonoClass = FMonoDomain::Class_From_Name(
-			TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+		return TCachedPropertyClass<T, TPropertyClass>::Get();
+	}
+
+	static MonoClass* Resolve()
+	{
+		const auto FoundGenericMonoClass = TGenericPropertyClass<T>::Get();
 
 		const auto FoundKeyMonoClass = TPropertyClass<
 				typename TTemplateTypeTraits<std::decay_t<T>>::template Type<0>,
@@ -293,8 +360,12 @@ struct TPropertyClass<T, std::enable_if_t<TIsTSet<std::decay_t<T>>::Value, T>>
 {
 	static auto Get()
 	{
-		const auto FoundGenericMonoClass = FMonoDomain::Class_From_Name(
-			TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+		return TCachedPropertyClass<T, TPropertyClass>::Get();
+	}
+
+	static MonoClass* Resolve()
+	{
+		const auto FoundGenericMonoClass = TGenericPropertyClass<T>::Get();
 
 		const auto FoundMonoClass = TPropertyClass<
 				typename TTemplateTypeTraits<std::decay_t<T>>::template Type<0>,
@@ -325,8 +396,12 @@ struct TPropertyClass<T, std::enable_if_t<TIsTArray<std::decay_t<T>>::Value, T>>
 {
 	static auto Get()
 	{
-		const auto FoundGenericMonoClass = FMonoDomain::Class_From_Name(
-			TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+		return TCachedPropertyClass<T, TPropertyClass>::Get();
+	}
+
+	static MonoClass* Resolve()
+	{
+		const auto FoundGenericMonoClass = TGenericPropertyClass<T>::Get();
 
 		const auto FoundMonoClass = TPropertyClass<
 				typename TTemplateTypeTraits<std::decay_t<T>>::template Type<0>,
@@ -351,7 +426,7 @@ struct TPropertyClass<T, std::enable_if_t<TIsEnum<std::decay_t<T>>::Value && !TI
 {
 	static auto Get()
 	{
-		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get());
+		return TNamePropertyClass<T>::Get();
 	}
 };
 
@@ -373,8 +448,12 @@ struct TPropertyClass<T, std::enable_if_t<TIsTOptional<std::decay_t<T>>::Value,
 {
 	static auto Get()
 	{
-		const auto FoundGenericMonoClass = FMonoDomain::Class_From_Name(
-			TGeneric<T, T>::GetNameSpace(), TGeneric<T, T>::GetGenericName());
+		return TCachedPropertyClass<T, TPropertyClass>::Get();
+	}
+
+	static MonoClass* Resolve()
+	{
+		const auto FoundGenericMonoClass = TGenericPropertyClass<T>::Get();
 
 		const auto FoundMonoClass = TPropertyClass<
 				typename TTemplateTypeTraits<std::decay_t<T>>::Type,
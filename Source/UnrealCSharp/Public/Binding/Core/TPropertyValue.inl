@@ -6,6 +6,7 @@
 #include "Reflection/Container/FArrayHelper.h"
 #include "Reflection/Container/FSetHelper.h"
 #include "Reflection/Container/FMapHelper.h"
+#include "Reflection/Container/FContainerElementPropertyCache.h"
 #include "Template/TGetArrayLength.inl"
 #include "Template/TTemplateTypeTraits.inl"
 #include "Template/TIsTScriptInterface.inl"
@@ -591,20 +592,14 @@ struct TPropertyValue<T, std::enable_if_t<TIsTMap<std::decay_t<T>>::Value, T>>
 			const auto FoundValuePropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 				Type_Get_Object(FoundValuePropertyMonoType);
 
-			const auto KeyProperty = FTypeBridge::Factory<>(FoundKeyPropertyReflectionType, nullptr, "",
-			                                                EObjectFlags::RF_Transient);
+			const auto KeyProperty = FContainerElementPropertyCache::Get(FoundKeyPropertyReflectionType);
 
-			KeyProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
-
-			const auto ValueProperty = FTypeBridge::Factory<>(FoundValuePropertyReflectionType, nullptr, "",
-			                                                  EObjectFlags::RF_Transient);
-
-			ValueProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
+			const auto ValueProperty = FContainerElementPropertyCache::Get(FoundValuePropertyReflectionType);
 
 			SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
 			const auto MapHelper = new FMapHelper(KeyProperty, ValueProperty,
-			                                      InMember, false, true);
+			                                      InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				InGarbageCollectionHandle, InMember, MapHelper, SrcMonoObject);
@@ -640,22 +635,16 @@ struct TPropertyValue<T, std::enable_if_t<TIsTMap<std::decay_t<T>>::Value, T>>
 		const auto FoundValuePropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 			Type_Get_Object(FoundValuePropertyMonoType);
 
-		const auto KeyProperty = FTypeBridge::Factory<>(FoundKeyPropertyReflectionType, nullptr, "",
-		                                                EObjectFlags::RF_Transient);
-
-		KeyProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
-
-		const auto ValueProperty = FTypeBridge::Factory<>(FoundValuePropertyReflectionType, nullptr, "",
-		                                                  EObjectFlags::RF_Transient);
+		const auto KeyProperty = FContainerElementPropertyCache::Get(FoundKeyPropertyReflectionType);
 
-		ValueProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
+		const auto ValueProperty = FContainerElementPropertyCache::Get(FoundValuePropertyReflectionType);
 
 		auto SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
 		if constexpr (IsReference)
 		{
 			const auto MapHelper = new FMapHelper(KeyProperty, ValueProperty,
-			                                      InMember, false, true);
+			                                      InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				MapHelper, SrcMonoObject);
@@ -663,7 +652,7 @@ struct TPropertyValue<T, std::enable_if_t<TIsTMap<std::decay_t<T>>::Value, T>>
 		else
 		{
 			const auto MapHelper = new FMapHelper(KeyProperty, ValueProperty,
-			                                      new std::decay_t<T>(*InMember), true, true);
+			                                      new std::decay_t<T>(*InMember), true, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				MapHelper, SrcMonoObject);
@@ -715,14 +704,11 @@ struct TPropertyValue<T, std::enable_if_t<TIsTSet<std::decay_t<T>>::Value, T>>
 			const auto FoundPropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 				Type_Get_Object(FoundPropertyMonoType);
 
-			const auto Property = FTypeBridge::Factory<>(FoundPropertyReflectionType, nullptr, "",
-			                                             EObjectFlags::RF_Transient);
-
-			Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
+			const auto Property = FContainerElementPropertyCache::Get(FoundPropertyReflectionType);
 
 			SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
-			const auto SetHelper = new FSetHelper(Property, InMember, false, true);
+			const auto SetHelper = new FSetHelper(Property, InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				InGarbageCollectionHandle, InMember, SetHelper, SrcMonoObject);
@@ -747,23 +733,20 @@ struct TPropertyValue<T, std::enable_if_t<TIsTSet<std::decay_t<T>>::Value, T>>
 		const auto FoundPropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 			Type_Get_Object(FoundPropertyMonoType);
 
-		const auto Property = FTypeBridge::Factory<>(FoundPropertyReflectionType, nullptr, "",
-		                                             EObjectFlags::RF_Transient);
-
-		Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
+		const auto Property = FContainerElementPropertyCache::Get(FoundPropertyReflectionType);
 
 		auto SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
 		if constexpr (IsReference)
 		{
-			const auto SetHelper = new FSetHelper(Property, InMember, false, true);
+			const auto SetHelper = new FSetHelper(Property, InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				SetHelper, SrcMonoObject);
 		}
 		else
 		{
-			const auto SetHelper = new FSetHelper(Property, new std::decay_t<T>(*InMember), true, true);
+			const auto SetHelper = new FSetHelper(Property, new std::decay_t<T>(*InMember), true, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				SetHelper, SrcMonoObject);
@@ -820,14 +803,11 @@ struct TPropertyValue<T, std::enable_if_t<TIsTArray<std::decay_t<T>>::Value, T>>
 			const auto FoundPropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 				Type_Get_Object(FoundPropertyMonoType);
 
-			const auto Property = FTypeBridge::Factory<>(FoundPropertyReflectionType, nullptr, "",
-			                                             EObjectFlags::RF_Transient);
-
-			Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
+			const auto Property = FContainerElementPropertyCache::Get(FoundPropertyReflectionType);
 
 			SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
-			const auto ArrayHelper = new FArrayHelper(Property, InMember, false, true);
+			const auto ArrayHelper = new FArrayHelper(Property, InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(
 				InGarbageCollectionHandle, InMember, ArrayHelper, SrcMonoObject);
@@ -852,22 +832,19 @@ struct TPropertyValue<T, std::enable_if_t<TIsTArray<std::decay_t<T>>::Value, T>>
 		const auto FoundPropertyReflectionType = FCSharpEnvironment::GetEnvironment().GetDomain()->
 			Type_Get_Object(FoundPropertyMonoType);
 
-		const auto Property = FTypeBridge::Factory<>(FoundPropertyReflectionType, nullptr, "",
-		                                             EObjectFlags::RF_Transient);
-
-		Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
+		const auto Property = FContainerElementPropertyCache::Get(FoundPropertyReflectionType);
 
 		auto SrcMonoObject = FCSharpEnvironment::GetEnvironment().GetDomain()->Object_New(FoundMonoClass);
 
 		if constexpr (IsReference)
 		{
-			const auto ArrayHelper = new FArrayHelper(Property, InMember, false, true);
+			const auto ArrayHelper = new FArrayHelper(Property, InMember, false, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(ArrayHelper, SrcMonoObject);
 		}
 		else
 		{
-			const auto ArrayHelper = new FArrayHelper(Property, new std::decay_t<T>(*InMember), true, true);
+			const auto ArrayHelper = new FArrayHelper(Property, new std::decay_t<T>(*InMember), true, false);
 
 			FCSharpEnvironment::GetEnvironment().AddContainerReference(ArrayHelper, SrcMonoObject);
 		}
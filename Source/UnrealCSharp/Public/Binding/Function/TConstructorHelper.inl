@@ -18,20 +18,30 @@ struct TConstructorHelper<std::tuple<Args...>>
 	{
 		std::tuple<TArgument<Args, Args>...> Argument(IN_BUFFER + std::get<Index>(TBufferOffset<Args...>()())...);
 
-		auto Value = new Class(std::forward<Args>(std::get<Index>(Argument).Get())...);
-
-		TOut<std::tuple<TArgument<Args, Args>...>>(OUT_BUFFER, Argument);
-
-		if constexpr (TIsScriptStruct<Class>::Value)
+		if constexpr (TIsBlittableStruct<Class>::Value)
 		{
-			FCSharpEnvironment::GetEnvironment().Bind<false>(TBaseStructure<Class>::Get());
+			// Blittable structs are constructed in place, the managed side passes the address of the value
+			new(InMonoObject) Class(std::forward<Args>(std::get<Index>(Argument).Get())...);
 
-			FCSharpEnvironment::GetEnvironment().AddStructReference<true>(
-				TBaseStructure<Class>::Get(), Value, InMonoObject);
+			TOut<std::tuple<TArgument<Args, Args>...>>(OUT_BUFFER, Argument);
 		}
 		else
 		{
-			FCSharpEnvironment::GetEnvironment().AddBindingReference<Class, true>(InMonoObject, Value);
+			auto Value = new Class(std::forward<Args>(std::get<Index>(Argument).Get())...);
+
+			TOut<std::tuple<TArgument<Args, Args>...>>(OUT_BUFFER, Argument);
+
+			if constexpr (TIsScriptStruct<Class>::Value)
+			{
+				FCSharpEnvironment::GetEnvironment().Bind<false>(TBaseStructure<Class>::Get());
+
+				FCSharpEnvironment::GetEnvironment().AddStructReference<true>(
+					TBaseStructure<Class>::Get(), Value, InMonoObject);
+			}
+			else
+			{
+				FCSharpEnvironment::GetEnvironment().AddBindingReference<Class, true>(InMonoObject, Value);
+			}
 		}
 	}
 };
@@ -15,6 +15,10 @@ struct TDestructorHelper<std::tuple<Args...>>
 	template <auto... Index>
 	static auto Call(std::index_sequence<Index...>, BINDING_DESTRUCTOR_SIGNATURE)
 	{
-		(void)FCSharpEnvironment::GetEnvironment().RemoveBindingReference(InGarbageCollectionHandle);
+		FCSharpEnvironment::GetEnvironment().AsyncRelease(
+			[](const FGarbageCollectionHandle& InReleaseGarbageCollectionHandle)
+			{
+				(void)FCSharpEnvironment::GetEnvironment().RemoveBindingReference(InReleaseGarbageCollectionHandle);
+			}, InGarbageCollectionHandle);
 	}
 };
@@ -2,21 +2,21 @@
 
 #include "TBaseStructure.inl"
 
-BINDING_SCRIPT_STRUCT(FRotator)
+BINDING_BLITTABLE_STRUCT(FRotator)
 
 BINDING_SCRIPT_STRUCT(FQuat)
 
 BINDING_SCRIPT_STRUCT(FTransform)
 
-BINDING_SCRIPT_STRUCT(FLinearColor)
+BINDING_BLITTABLE_STRUCT(FLinearColor)
 
-BINDING_SCRIPT_STRUCT(FColor)
+BINDING_BLITTABLE_STRUCT(FColor)
 
 BINDING_SCRIPT_STRUCT(FPlane)
 
-BINDING_SCRIPT_STRUCT(FVector)
+BINDING_BLITTABLE_STRUCT(FVector)
 
-BINDING_SCRIPT_STRUCT(FVector2D)
+BINDING_BLITTABLE_STRUCT(FVector2D)
 
 BINDING_SCRIPT_STRUCT(FVector4)
 
@@ -62,7 +62,7 @@ BINDING_SCRIPT_STRUCT(FTestUninitializedScriptStructMembersTest)
 
 BINDING_SCRIPT_STRUCT(FMatrix)
 
-BINDING_SCRIPT_STRUCT(FIntPoint)
+BINDING_BLITTABLE_STRUCT(FIntPoint)
 
 BINDING_SCRIPT_STRUCT(FTimespan)
 
@@ -72,7 +72,7 @@ BINDING_SCRIPT_STRUCT(FBox)
 
 BINDING_SCRIPT_STRUCT(FBoxSphereBounds)
 
-BINDING_SCRIPT_STRUCT(FIntVector)
+BINDING_BLITTABLE_STRUCT(FIntVector)
 
 BINDING_SCRIPT_STRUCT(FExpressionInput)
 
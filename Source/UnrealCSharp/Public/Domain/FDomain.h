@@ -116,6 +116,8 @@ public:
 
 	mono_bool Type_Is_ByRef(MonoType* InMonoType) const;
 
+	static mono_bool Type_Is_Reference(MonoType* InMonoType);
+
 	MonoReflectionMethod* Method_Get_Object(MonoMethod* InMethod, MonoClass* InMonoClass) const;
 
 	static MonoObject* Runtime_Invoke(MonoMethod* InFunction, void* InMonoObject, void** InParams);
@@ -145,6 +147,12 @@ public:
 
 	char* String_To_UTF8(MonoString* InMonoString) const;
 
+	MonoString* String_New_UTF16(const mono_unichar2* InText, int32 InLength) const;
+
+	mono_unichar2* String_Chars(MonoString* InMonoString) const;
+
+	int32 String_Length(MonoString* InMonoString) const;
+
 	MonoArray* Array_New(MonoClass* InMonoClass, uint32 InNum) const;
 
 	uint64 Array_Length(MonoArray* InMonoArray) const;
@@ -217,6 +225,10 @@ public:
 
 	static mono_bool Type_Is_Enum(MonoType* InMonoType);
 
+	MonoString* String_New(const TCHAR* InText, int32 InLength) const;
+
+	static FString String_To_FString(MonoString* InMonoString);
+
 	SynchronizationContextTickType SynchronizationContextTick;
 
 public:
@@ -11,7 +11,10 @@
 #include "Template/TIsUObject.inl"
 #include "Template/TIsUStruct.inl"
 #include "Template/TIsScriptStruct.inl"
+#include "Template/TIsBlittableStruct.inl"
 #include "GarbageCollection/FGarbageCollectionHandle.h"
+#include "GarbageCollection/FGarbageCollectionReleaseQueue.h"
+#include "Containers/Ticker.h"
 #include "UEVersion.h"
 
 class UNREALCSHARP_API FCSharpEnvironment
@@ -45,6 +48,10 @@ public:
 
 	void OnAsyncLoadingFlushUpdate();
 
+	bool OnAsyncLoadingTick(float InDeltaTime);
+
+	bool OnReleaseTick(float InDeltaTime);
+
 public:
 	template <auto IsNeedMonoClass>
 	auto Bind(UStruct* InStruct) const;
@@ -267,7 +274,7 @@ public:
 	};
 
 	template <typename T>
-	class TGetObject<T, std::enable_if_t<TIsScriptStruct<T>::Value, T>>
+	class TGetObject<T, std::enable_if_t<TIsScriptStruct<T>::Value && !TIsBlittableStruct<T>::Value, T>>
 	{
 	public:
 		auto operator()(const FCSharpEnvironment& InEnvironment,
@@ -277,6 +284,20 @@ public:
 		}
 	};
 
+	/*
+	 * Blittable structs live in managed memory, the handle slot carries the address of the value itself.
+	 */
+	template <typename T>
+	class TGetObject<T, std::enable_if_t<TIsBlittableStruct<T>::Value, T>>
+	{
+	public:
+		auto operator()(const FCSharpEnvironment& InEnvironment,
+		                const FGarbageCollectionHandle& InGarbageCollectionHandle) const
+		{
+			return reinterpret_cast<T*>(static_cast<GarbageCollectionHandleType>(InGarbageCollectionHandle));
+		}
+	};
+
 	template <typename T>
 	class TGetObject<T, std::enable_if_t<!(TIsUObject<T>::Value ||
 		                                     TIsUStruct<T>::Value ||
@@ -291,6 +312,10 @@ public:
 		}
 	};
 
+public:
+	void AsyncRelease(FGarbageCollectionReleaseQueue::ReleaseType InRelease,
+	                  const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
 public:
 	bool AddReference(const FGarbageCollectionHandle& InOwner, class FReference* InReference) const;
 
@@ -314,11 +339,22 @@ private:
 
 	FDelegateHandle OnAsyncLoadingFlushUpdateHandle;
 
+	FTSTicker::FDelegateHandle OnAsyncLoadingTickHandle;
+
+	FTSTicker::FDelegateHandle OnReleaseTickHandle;
+
 private:
-	FCriticalSection CriticalSection;
+	// Objects created off the game thread, handed over without taking a lock
+	TQueue<FWeakObjectPtr, EQueueMode::Mpsc> AsyncLoadingObjectQueue;
 
+	// Objects still loading or deferred by the time budget, only touched on the game thread
 	TArray<FWeakObjectPtr> AsyncLoadingObjectArray;
 
+	// In seconds, read from the setting once per initialize instead of on every update
+	double AsyncLoadingBindTimeBudget = 0.0;
+
+	FGarbageCollectionReleaseQueue ReleaseQueue;
+
 private:
 	FDynamicRegistry* DynamicRegistry;
 
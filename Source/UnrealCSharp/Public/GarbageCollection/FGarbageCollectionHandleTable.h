@@ -0,0 +1,27 @@
+﻿#pragma once
+
+#include "FGarbageCollectionHandle.h"
+
+/*
+ * Mono encodes a gc handle as its slot in the runtime handle table shifted left by three, with the handle type in the
+ * low bits. Slots are dense and reused, so they index a flat array that maps every live handle to the position of its
+ * value in the owning TGarbageCollectionHandleMapping, no hashing is needed to resolve a handle.
+ * Several mappings may hold the same handle, so every mapping owns its table.
+ */
+class UNREALCSHARP_API FGarbageCollectionHandleTable
+{
+public:
+	int32 Get(const FGarbageCollectionHandle& InGarbageCollectionHandle) const;
+
+	void Set(const FGarbageCollectionHandle& InGarbageCollectionHandle, int32 InIndex);
+
+	void Reset(const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+	void Empty();
+
+private:
+	static uint32 GetSlot(const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+private:
+	TArray<int32> Indices;
+};
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include "FGarbageCollectionHandle.h"
+#include "Containers/Queue.h"
+
+/*
+ * Managed finalizers run on the GC finalizer thread, while the registries may only be touched on the game thread.
+ * Finalizers push their handle here and the game thread releases everything pending in one pass.
+ */
+class FGarbageCollectionReleaseQueue
+{
+public:
+	typedef void (*ReleaseType)(const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+public:
+	void Enqueue(ReleaseType InRelease, const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+	void Drain(double InTimeBudget = 0.0);
+
+	void Empty();
+
+private:
+	struct FRelease
+	{
+		ReleaseType Release;
+
+		FGarbageCollectionHandle GarbageCollectionHandle;
+	};
+
+	TQueue<FRelease, EQueueMode::Mpsc> Queue;
+};
@@ -79,10 +79,17 @@ public:
 			FMonoDomain::Property_Get_Value(InMonoProperty, InMonoObject, nullptr, nullptr)));
 	}
 
-	static auto MonoObject2GarbageCollectionHandle(MonoObject* InMonoObject)
+	static auto MonoObject2GarbageCollectionHandle(MonoObject* InMonoObject) -> T*
 	{
-		const auto FoundProperty = FMonoDomain::Class_Get_Property_From_Name(
-			FMonoDomain::Object_Get_Class(InMonoObject), PROPERTY_GARBAGE_COLLECTION_HANDLE);
+		const auto Class = FMonoDomain::Object_Get_Class(InMonoObject);
+
+		// The handle is read straight from the backing field instead of invoking the managed getter
+		if (const auto Offset = FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(Class); Offset != 0)
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<uint8*>(InMonoObject) + Offset);
+		}
+
+		const auto FoundProperty = FMonoDomain::Class_Get_Property_From_Name(Class, PROPERTY_GARBAGE_COLLECTION_HANDLE);
 
 		return FoundProperty != nullptr
 			       ? MonoObject2GarbageCollectionHandle(InMonoObject, FoundProperty)
@@ -1,9 +1,104 @@
 ﻿#pragma once
 
-#include "TMapping.inl"
 #include "FGarbageCollectionHandle.h"
+#include "FGarbageCollectionHandleTable.h"
 
 template <typename T>
-class TGarbageCollectionHandleMapping : public TMapping<FGarbageCollectionHandle, T>
+class TGarbageCollectionHandleMapping
 {
+public:
+	typedef FGarbageCollectionHandle KeyType;
+
+	typedef T ValueType;
+
+	struct FEntry
+	{
+		KeyType Key;
+
+		ValueType Value;
+	};
+
+public:
+	auto operator[](const KeyType& InKey) -> ValueType&
+	{
+		const auto FoundValue = Find(InKey);
+
+		check(FoundValue != nullptr);
+
+		return *FoundValue;
+	}
+
+	auto Empty()
+	{
+		Table.Empty();
+
+		Entries.Empty();
+	}
+
+	auto Add(const KeyType& InKey, const ValueType& InValue)
+	{
+		if (const auto FoundValue = Find(InKey))
+		{
+			*FoundValue = InValue;
+		}
+		else
+		{
+			Table.Set(InKey, Entries.Add({InKey, InValue}));
+		}
+	}
+
+	auto Remove(const KeyType& InKey) -> int32
+	{
+		if (const auto Index = FindIndex(InKey); Index != INDEX_NONE)
+		{
+			Table.Reset(InKey);
+
+			Entries.RemoveAt(Index);
+
+			return 1;
+		}
+
+		return 0;
+	}
+
+	auto Find(const KeyType& InKey) -> ValueType*
+	{
+		const auto Index = FindIndex(InKey);
+
+		return Index != INDEX_NONE ? &Entries[Index].Value : nullptr;
+	}
+
+	auto Contains(const KeyType& InKey) const
+	{
+		return FindIndex(InKey) != INDEX_NONE;
+	}
+
+public:
+	auto Get() -> TSparseArray<FEntry>&
+	{
+		return Entries;
+	}
+
+private:
+	auto FindIndex(const KeyType& InKey) const -> int32
+	{
+		if (!InKey.IsValid())
+		{
+			return INDEX_NONE;
+		}
+
+		// The handle stored with the value rejects stale handles whose slot has been reused
+		if (const auto Index = Table.Get(InKey);
+			Entries.IsValidIndex(Index) && Entries[Index].Key == InKey)
+		{
+			return Index;
+		}
+
+		return INDEX_NONE;
+	}
+
+private:
+	TSparseArray<FEntry> Entries;
+
+	FGarbageCollectionHandleTable Table;
 };
@@ -17,6 +17,7 @@
 #include "Binding/Function/TOverloadBuilder.inl"
 #include "Template/TFunctionPointer.inl"
 #include "Template/TIsScriptStruct.inl"
+#include "Template/TIsBlittableStruct.inl"
 #include "Template/TIsNotUEnum.inl"
 
 template <typename... Args>
@@ -158,6 +159,63 @@ struct TIsScriptStruct<Class> \
 	enum { Value = true }; \
 };
 
+#define BINDING_BLITTABLE_STRUCT(Class) \
+template <typename T> \
+struct TName<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
+{ \
+	static auto Get() { return F_STRING_STR(Class); } \
+}; \
+template <typename T> \
+struct TNameSpace<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
+{ \
+	static auto Get() \
+	{ \
+		return TArray<FString>{FUnrealCSharpFunctionLibrary::GetClassNameSpace(TBaseStructure<std::decay_t<T>>::Get())}; \
+	} \
+}; \
+template <typename T> \
+struct TPropertyClass<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> : \
+	TScriptStructPropertyClass<T> \
+{ \
+}; \
+template <typename T> \
+struct TPropertyValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> : \
+	TPrimitivePropertyValue<T> \
+{ \
+}; \
+template <typename InClass, typename Result, Result InClass::* Member> \
+struct TPropertyBuilder<Result InClass::*, Member, std::enable_if_t<std::is_same_v<std::decay_t<Result>, Class>>> : \
+	TPrimitivePropertyBuilder<InClass, Result, Member> \
+{ \
+}; \
+template <typename Result, Result* Member> \
+struct TPropertyBuilder<Result*, Member, std::enable_if_t<std::is_same_v<std::decay_t<Result>, Class>>> : \
+	TPrimitivePropertyBuilder<void, Result, Member> \
+{ \
+}; \
+template <typename T> \
+struct TArgument<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> : \
+	TPrimitiveArgument<T> \
+{ \
+	using TPrimitiveArgument<T>::TPrimitiveArgument; \
+}; \
+template <typename T> \
+struct TReturnValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>>> : \
+	TPrimitiveReturnValue<T> \
+{ \
+	using TPrimitiveReturnValue<T>::TPrimitiveReturnValue; \
+}; \
+template <> \
+struct TIsScriptStruct<Class> \
+{ \
+	enum { Value = true }; \
+}; \
+template <> \
+struct TIsBlittableStruct<Class> \
+{ \
+	enum { Value = true }; \
+};
+
 #define BINDING_ENUM(Class, ...) \
 template <typename T> \
 struct TName<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
@@ -64,18 +64,17 @@
 
 #define FUNCTION_GREATER_EQUAL FString(TEXT("GreaterEqual"))
 
-#define INITIALIZE_VALUE() \
-	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index) \
+#define IN_BEGIN() \
+	for (const auto& ParamPlan : ParamPlans) \
 	{ \
-		const auto& PropertyDescriptor = PropertyDescriptors[Index]; \
-		PropertyDescriptor->InitializeValue_InContainer(Params);
+		const auto ParamAddress = static_cast<uint8*>(Params) + ParamPlan.Offset;
 
 #define IN_VALUE() \
-		PropertyDescriptor->Set(IN_BUFFER, PropertyDescriptor->ContainerPtrToValuePtr<void>(Params)); \
-		IN_BUFFER += PropertyDescriptor->GetBufferSize();
+		ParamPlan.PropertyDescriptor->Set(IN_BUFFER, ParamAddress); \
+		IN_BUFFER += ParamPlan.BufferSize;
 
 #define REFERENCE_IN_VALUE() \
-		if (ReferencePropertyIndexes.Contains(Index) || !OutPropertyIndexes.Contains(Index)) \
+		if (ParamPlan.bIsReferenceIn) \
 		{ \
 			IN_VALUE() \
 		}
@@ -84,20 +83,20 @@
 	}
 
 #define PROCESS_SCRIPT_IN() \
-	INITIALIZE_VALUE() \
+	IN_BEGIN() \
 	IN_VALUE() \
 	IN_END()
 
 #define PROCESS_SCRIPT_REFERENCE_IN() \
-	INITIALIZE_VALUE() \
+	IN_BEGIN() \
 	REFERENCE_IN_VALUE() \
 	IN_END()
 
 #define NATIVE_OUT_VALUE() \
 		CA_SUPPRESS(6263) \
 		const auto Out = (FOutParmRec*)FMemory_Alloca(sizeof(FOutParmRec)); \
-		Out->Property = PropertyDescriptor->GetProperty(); \
-		Out->PropAddr = (uint8*)PropertyDescriptor->ContainerPtrToValuePtr<void>(Params); \
+		Out->Property = ParamPlan.Property; \
+		Out->PropAddr = ParamAddress; \
 		if (*LastOut) \
 		{ \
 			(*LastOut)->NextOutParm = Out; \
@@ -110,40 +109,40 @@
 
 #define PROCESS_NATIVE_REFERENCE_IN() \
 	auto LastOut = &Stack.OutParms; \
-	INITIALIZE_VALUE() \
+	IN_BEGIN() \
 	IN_VALUE() \
 	NATIVE_OUT_VALUE() \
 	IN_END()
 
 #define PROCESS_OUT() \
-	for (auto Index = 0; Index < OutPropertyIndexes.Num(); ++Index) \
+	for (const auto& OutParamPlan : OutParamPlans) \
 	{ \
-		if (const auto OutPropertyDescriptor = PropertyDescriptors[OutPropertyIndexes[Index]]) \
+		const auto OutParamAddress = static_cast<uint8*>(Params) + OutParamPlan.Offset; \
+		if (OutParamPlan.bIsPrimitive) \
 		{ \
-			if (OutPropertyDescriptor->IsPrimitiveProperty()) \
-			{ \
-				OutPropertyDescriptor->Get(OutPropertyDescriptor->ContainerPtrToValuePtr<void>(Params), \
-										   OUT_BUFFER); \
-			} \
-			else \
-			{ \
-				OutPropertyDescriptor->Get<std::true_type>( \
-					OutPropertyDescriptor->CopyValue(OutPropertyDescriptor->ContainerPtrToValuePtr<void>(Params)), \
-					reinterpret_cast<void**>(OUT_BUFFER)); \
-			} \
-			OUT_BUFFER += OutPropertyDescriptor->GetBufferSize(); \
+			OutParamPlan.PropertyDescriptor->Get(OutParamAddress, OUT_BUFFER); \
 		} \
+		else \
+		{ \
+			OutParamPlan.PropertyDescriptor->Get<std::true_type>( \
+				OutParamPlan.PropertyDescriptor->CopyValue(OutParamAddress), \
+				reinterpret_cast<void**>(OUT_BUFFER)); \
+		} \
+		OUT_BUFFER += OutParamPlan.BufferSize; \
 	}
 
+#define RETURN_ADDRESS() \
+	(static_cast<uint8*>(Params) + ReturnOffset)
+
 #define PROCESS_RETURN() \
 	if constexpr (ReturnType == EFunctionReturnType::Primitive) \
 	{ \
-		ReturnPropertyDescriptor->Get(ReturnPropertyDescriptor->ContainerPtrToValuePtr<void>(Params), RETURN_BUFFER); \
+		ReturnPropertyDescriptor->Get(RETURN_ADDRESS(), RETURN_BUFFER); \
 	} \
 	else if constexpr (ReturnType == EFunctionReturnType::Compound) \
 	{ \
 		ReturnPropertyDescriptor->Get<std::true_type>( \
-			ReturnPropertyDescriptor->CopyValue(ReturnPropertyDescriptor->ContainerPtrToValuePtr<void>(Params)), \
+			ReturnPropertyDescriptor->CopyValue(RETURN_ADDRESS()), \
 			reinterpret_cast<void**>(RETURN_BUFFER)); \
 	} \
 	BufferAllocator->Free(Params);
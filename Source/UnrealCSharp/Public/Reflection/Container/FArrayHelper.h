@@ -68,6 +68,14 @@ public:
 
 	void Swap(int32 InFirstIndexToSwap, int32 InSecondIndexToSwap) const;
 
+	bool IsBlittable(int32 InTypeSize) const;
+
+	void* GetData(int32 InTypeSize) const;
+
+	int32 CopyTo(void* OutBuffer, int32 InIndex, int32 InCount, int32 InTypeSize) const;
+
+	bool CopyFrom(const void* InBuffer, int32 InCount, int32 InTypeSize) const;
+
 	FPropertyDescriptor* GetInnerPropertyDescriptor() const;
 
 	FScriptArray* GetScriptArray() const;
@@ -0,0 +1,18 @@
+﻿#pragma once
+
+#include "mono/metadata/object-forward.h"
+
+/*
+ * Containers constructed from C# need an element property per instance, one transient property is built
+ * per element type instead and shared by every container until the domain is torn down.
+ */
+class FContainerElementPropertyCache
+{
+public:
+	static FProperty* Get(MonoReflectionType* InReflectionType);
+
+	static void Empty();
+
+private:
+	static TMap<MonoType*, FProperty*> Properties;
+};
@@ -36,6 +36,8 @@ public:
 
 	void Set(void* InKey, void* InValue) const;
 
+	void Append(int32 InNum, uint8* InKeys, uint8* InValues) const;
+
 	FPropertyDescriptor* GetKeyPropertyDescriptor() const;
 
 	FPropertyDescriptor* GetValuePropertyDescriptor() const;
@@ -50,6 +52,16 @@ public:
 
 	void* GetEnumeratorValue(int32 InIndex) const;
 
+	bool IsBlittable(int32 InKeyTypeSize, int32 InValueTypeSize) const;
+
+	int32 Enumerate(int32& InOutIndex, void* OutKeyBuffer, void* OutValueBuffer, int32 InCount,
+	                int32 InKeyTypeSize, int32 InValueTypeSize) const;
+
+private:
+	int32 FindPairIndex(const void* InKey) const;
+
+	int32 FindPairIndex(const void* InKey, uint32 InKeyHash) const;
+
 private:
 	FPropertyDescriptor* KeyPropertyDescriptor;
 
@@ -26,6 +26,8 @@ public:
 
 	void Add(void* InValue) const;
 
+	void Append(int32 InNum, uint8* InValues) const;
+
 	int32 Remove(const void* InValue) const;
 
 	bool Contains(const void* InValue) const;
@@ -38,6 +40,15 @@ public:
 
 	void* GetEnumerator(int32 InIndex) const;
 
+	bool IsBlittable(int32 InTypeSize) const;
+
+	int32 Enumerate(int32& InOutIndex, void* OutBuffer, int32 InCount, int32 InTypeSize) const;
+
+private:
+	int32 FindIndex(const void* InValue) const;
+
+	int32 FindIndex(const void* InValue, uint32 InValueHash) const;
+
 private:
 	FPropertyDescriptor* ElementPropertyDescriptor;
 
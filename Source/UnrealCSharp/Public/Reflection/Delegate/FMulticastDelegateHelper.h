@@ -73,6 +73,21 @@ public:
 
 	FName GetFunctionName() const;
 
+	static void EmptyHandlerPool();
+
+private:
+	static UMulticastDelegateHandler* AcquireHandler();
+
+	static void ReleaseHandler(UMulticastDelegateHandler* InMulticastDelegateHandler);
+
 private:
 	TWeakObjectPtr<UMulticastDelegateHandler> MulticastDelegateHandler;
+
+	/*
+	 * Multicast delegates are wrapped every time one is read from a property, handlers that were never bound
+	 * to a delegate we do not own stay rooted here and are reused instead of creating a new rooted UObject.
+	 */
+	static TArray<UMulticastDelegateHandler*> HandlerPool;
+
+	static constexpr auto MaxHandlerPoolSize = 1024;
 };
@@ -109,9 +109,14 @@ public:
 
 	UFunction* GetCallBack() const;
 
+	bool IsRecyclable() const;
+
 private:
 	bool bNeedFree;
 
+	// Once handed out, other delegates may be bound to this handler and it can no longer be reused
+	mutable bool bIsExposed;
+
 	FMulticastScriptDelegate* MulticastScriptDelegate;
 
 	FCSharpDelegateDescriptor* DelegateDescriptor;
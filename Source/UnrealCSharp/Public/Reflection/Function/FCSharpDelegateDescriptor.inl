@@ -27,6 +27,11 @@ void FCSharpDelegateDescriptor::Execute2(const FScriptDelegate* InScriptDelegate
 	PROCESS_SCRIPT_IN()
 
 	InScriptDelegate->ProcessDelegate<UObject>(Params);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -50,6 +55,11 @@ void FCSharpDelegateDescriptor::Execute4(const FScriptDelegate* InScriptDelegate
 	InScriptDelegate->ProcessDelegate<UObject>(Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -63,6 +73,11 @@ void FCSharpDelegateDescriptor::Execute6(const FScriptDelegate* InScriptDelegate
 	InScriptDelegate->ProcessDelegate<UObject>(Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -95,6 +110,11 @@ void FCSharpDelegateDescriptor::Broadcast2(const FMulticastScriptDelegate* InMul
 	PROCESS_SCRIPT_IN()
 
 	InMulticastScriptDelegate->ProcessMulticastDelegate<UObject>(Params);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -106,6 +126,11 @@ void FCSharpDelegateDescriptor::Broadcast4(const FMulticastScriptDelegate* InMul
 	InMulticastScriptDelegate->ProcessMulticastDelegate<UObject>(Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -119,4 +144,9 @@ void FCSharpDelegateDescriptor::Broadcast6(const FMulticastScriptDelegate* InMul
 	InMulticastScriptDelegate->ProcessMulticastDelegate<UObject>(Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "FFunctionDescriptor.h"
+#include "FCSharpFunctionThunk.h"
 #include "mono/metadata/object-forward.h"
 
 class FCSharpFunctionDescriptor final : public FFunctionDescriptor
@@ -20,6 +21,14 @@ public:
 	bool CallCSharp(UObject* InContext, FFrame& InStack, RESULT_DECL);
 
 private:
+	void InitializeThunk();
+
+	void CallThunk(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams, RESULT_DECL) const;
+
+	void CallRuntimeInvoke(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams, RESULT_DECL) const;
+
+	void* GetPropertyAddress(int32 InIndex, void* InParams, FOutParmRec*& InOutParams) const;
+
 	static FOutParmRec* FindOutParmRec(FOutParmRec* OutParam, const FProperty* OutProperty);
 
 private:
@@ -32,4 +41,14 @@ private:
 	FNativeFuncPtr OriginalNativeFuncPtr;
 
 	MonoMethod* Method;
+
+	void* Thunk;
+
+	FCSharpFunctionThunk::InvokerType ThunkInvoker;
+
+	bool bIsThunkInstance;
+
+	FCSharpFunctionThunkParam ReturnThunkParam;
+
+	TArray<FCSharpFunctionThunkParam> ThunkParams;
 };
@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include "mono/metadata/object-forward.h"
+
+enum class ECSharpFunctionThunkType : uint8
+{
+	Void,
+	Integer,
+	Floating,
+	Object
+};
+
+struct FCSharpFunctionThunkParam
+{
+	ECSharpFunctionThunkType Type = ECSharpFunctionThunkType::Void;
+
+	uint8 Size = 0;
+
+	bool bIsSigned = false;
+
+	bool bIsByRef = false;
+};
+
+/*
+ * Every argument of an unmanaged thunk is carried in a 64 bit slot, integers and objects are passed
+ * through integer registers and floating point values through vector registers. A float is passed as
+ * the low half of a double slot, which the 64 bit calling conventions we support read back unchanged.
+ */
+class FCSharpFunctionThunk
+{
+public:
+	typedef uint64 (*InvokerType)(void* InThunk, const uint64* InArguments, MonoObject** OutException);
+
+	static constexpr auto MaxArgumentCount = 6;
+
+public:
+	static bool IsSupported();
+
+	static InvokerType GetInvoker(ECSharpFunctionThunkType InReturnType, int32 InArgumentCount,
+	                              uint32 InFloatingMask);
+
+	static bool GetParam(FProperty* InProperty, bool bIsPrimitive, MonoType* InMonoType,
+	                     FCSharpFunctionThunkParam& OutParam);
+
+	static uint64 ToArgument(const FCSharpFunctionThunkParam& InParam, uint64 InValue);
+};
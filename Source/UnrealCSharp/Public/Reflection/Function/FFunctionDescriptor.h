@@ -19,6 +19,27 @@ public:
 public:
 	FString GetName() const;
 
+protected:
+	/*
+	 * Everything the call macros need per parameter is resolved once when the descriptor is built,
+	 * so a call walks the plan front to back without property lookups or index searches.
+	 */
+	struct FParamPlan
+	{
+		FPropertyDescriptor* PropertyDescriptor;
+
+		FProperty* Property;
+
+		int32 Offset;
+
+		int32 BufferSize;
+
+		bool bIsPrimitive;
+
+		// Reference parameters and everything that is not an out parameter are read from the in buffer
+		bool bIsReferenceIn;
+	};
+
 protected:
 	TWeakObjectPtr<UFunction> Function;
 
@@ -30,5 +51,11 @@ protected:
 
 	TArray<uint32> OutPropertyIndexes;
 
+	TArray<FParamPlan> ParamPlans;
+
+	TArray<FParamPlan> OutParamPlans;
+
+	int32 ReturnOffset;
+
 	TSharedPtr<FFunctionParamBufferAllocator> BufferAllocator;
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "Misc/ThreadSingleton.h"
+
 class FFunctionParamBufferAllocator
 {
 public:
@@ -18,32 +20,45 @@ public:
 	using FFunctionParamBufferAllocator::FFunctionParamBufferAllocator;
 };
 
-class FFunctionParamPoolBufferAllocator final : public FFunctionParamBufferAllocator
+/*
+ * Param buffers of every descriptor are carved from one per thread stack of blocks, a call frees its buffer
+ * before returning, so re-entrant and recursive calls just push deeper and never reach the heap once warmed up.
+ */
+class FFunctionParamFrameStack final : public TThreadSingleton<FFunctionParamFrameStack>
 {
 public:
-	explicit FFunctionParamPoolBufferAllocator(const TWeakObjectPtr<UFunction>& InFunction);
+	FFunctionParamFrameStack();
 
-	virtual ~FFunctionParamPoolBufferAllocator() override;
+	virtual ~FFunctionParamFrameStack() override;
 
 public:
-	virtual void* Malloc() override;
+	void* Push(int32 InSize);
 
-	virtual void Free(void* InMemory) override;
+	void Pop(void* InMemory);
 
 private:
-	uint8 Count;
+	struct FBlock
+	{
+		uint8* Data;
 
-	decltype(UFunction::ParmsSize) ParamSize;
+		int32 Size;
+
+		int32 Top;
+	};
 
-	TArray<void*> Buffers;
+	static constexpr auto BlockSize = 64 * 1024;
+
+	static constexpr auto Alignment = 16;
+
+	TArray<FBlock> Blocks;
+
+	int32 Current;
 };
 
-class FFunctionParamPersistentBufferAllocator final : public FFunctionParamBufferAllocator
+class FFunctionParamStackBufferAllocator final : public FFunctionParamBufferAllocator
 {
 public:
-	explicit FFunctionParamPersistentBufferAllocator(const TWeakObjectPtr<UFunction>& InFunction);
-
-	virtual ~FFunctionParamPersistentBufferAllocator() override;
+	explicit FFunctionParamStackBufferAllocator(const TWeakObjectPtr<UFunction>& InFunction);
 
 public:
 	virtual void* Malloc() override;
@@ -51,7 +66,10 @@ public:
 	virtual void Free(void* InMemory) override;
 
 private:
-	void* Params;
+	decltype(UFunction::ParmsSize) ParamSize;
+
+	// Zeroed memory is a valid value for these, the rest are constructed explicitly
+	TArray<FProperty*> NonZeroConstructorProperties;
 };
 
 class FFunctionParamBufferAllocatorFactory
@@ -12,6 +12,9 @@ public:
 public:
 	explicit FUnrealFunctionDescriptor(UFunction* InFunction);
 
+public:
+	UObject* GetDefaultObject() const;
+
 public:
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Call0(UObject* InObject) const;
@@ -63,6 +66,11 @@ public:
 
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Call26(UObject* InObject, IN_BUFFER_SIGNATURE) const;
+
+private:
+	// Static functions are dispatched on the default object of their owning class,
+	// rebound when the class default object has been recreated, such as after a reinstance
+	mutable TWeakObjectPtr<UObject> DefaultObject;
 };
 
 #include "FUnrealFunctionDescriptor.inl"
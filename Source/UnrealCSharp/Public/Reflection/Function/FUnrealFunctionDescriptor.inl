@@ -27,6 +27,11 @@ void FUnrealFunctionDescriptor::Call2(UObject* InObject, IN_BUFFER_SIGNATURE) co
 	PROCESS_SCRIPT_IN()
 
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -49,6 +54,11 @@ void FUnrealFunctionDescriptor::Call4(UObject* InObject, OUT_BUFFER_SIGNATURE) c
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -61,6 +71,11 @@ void FUnrealFunctionDescriptor::Call6(UObject* InObject, IN_BUFFER_SIGNATURE, OU
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -93,7 +108,7 @@ void FUnrealFunctionDescriptor::Call9(UObject* InObject, RETURN_BUFFER_SIGNATURE
 
 	FFrame Stack(InObject, Function.Get(), Params, nullptr, Function->ChildProperties);
 
-	Function->Invoke(InObject, Stack, ReturnPropertyDescriptor->ContainerPtrToValuePtr<void>(Params));
+	Function->Invoke(InObject, Stack, RETURN_ADDRESS());
 
 	PROCESS_RETURN()
 }
@@ -108,6 +123,11 @@ void FUnrealFunctionDescriptor::Call10(UObject* InObject, IN_BUFFER_SIGNATURE) c
 	PROCESS_NATIVE_REFERENCE_IN()
 
 	Function->Invoke(InObject, Stack, nullptr);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -119,7 +139,7 @@ void FUnrealFunctionDescriptor::Call11(UObject* InObject, IN_BUFFER_SIGNATURE, R
 
 	PROCESS_NATIVE_REFERENCE_IN()
 
-	Function->Invoke(InObject, Stack, ReturnPropertyDescriptor->ContainerPtrToValuePtr<void>(Params));
+	Function->Invoke(InObject, Stack, RETURN_ADDRESS());
 
 	PROCESS_RETURN()
 }
@@ -136,6 +156,11 @@ void FUnrealFunctionDescriptor::Call14(UObject* InObject, IN_BUFFER_SIGNATURE, O
 	Function->Invoke(InObject, Stack, nullptr);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -148,7 +173,7 @@ void FUnrealFunctionDescriptor::Call15(UObject* InObject, IN_BUFFER_SIGNATURE, O
 
 	PROCESS_NATIVE_REFERENCE_IN()
 
-	Function->Invoke(InObject, Stack, ReturnPropertyDescriptor->ContainerPtrToValuePtr<void>(Params));
+	Function->Invoke(InObject, Stack, RETURN_ADDRESS());
 
 	PROCESS_OUT()
 
@@ -53,6 +53,8 @@ public:
 
 	FORCEINLINE uint32 GetValueTypeHash(const void* Src) const;
 
+	uint32 GetBufferValueTypeHash(const void* InBuffer) const;
+
 	FORCEINLINE bool SameType(const FPropertyDescriptor* Other) const;
 
 	virtual bool IsPrimitiveProperty() const;
@@ -0,0 +1,9 @@
+﻿#pragma once
+
+#include "Reflection/Property/TPrimitivePropertyDescriptor.inl"
+
+class FBlittableStructPropertyDescriptor final : public TPrimitivePropertyDescriptor<FStructProperty>
+{
+public:
+	using TPrimitivePropertyDescriptor::TPrimitivePropertyDescriptor;
+};
@@ -2,6 +2,7 @@
 
 #include "Environment/FCSharpEnvironment.h"
 #include "Bridge/FTypeBridge.h"
+#include "Reflection/Container/FContainerElementPropertyCache.h"
 
 template <auto IsNeedMonoClass>
 auto FCSharpBind::Bind(FDomain* InDomain, UStruct* InStruct)
@@ -95,11 +96,9 @@ auto FCSharpBind::BindImplementation(FDomain* InDomain, UObject* InObject) -> Mo
 template <typename T>
 auto FCSharpBind::BindImplementation(MonoObject* InMonoObject, MonoReflectionType* InReflectionType)
 {
-	const auto Property = FTypeBridge::Factory<>(InReflectionType, nullptr, "", EObjectFlags::RF_Transient);
+	const auto Property = FContainerElementPropertyCache::Get(InReflectionType);
 
-	Property->SetPropertyFlags(CPF_HasGetValueTypeHash);
-
-	const auto ContainerHelper = new T(Property, nullptr, true, true);
+	const auto ContainerHelper = new T(Property, nullptr, true, false);
 
 	FCSharpEnvironment::GetEnvironment().AddContainerReference(ContainerHelper, InMonoObject);
 
@@ -110,16 +109,11 @@ template <typename T>
 auto FCSharpBind::BindImplementation(MonoObject* InMonoObject, MonoReflectionType* InKeyReflectionType,
                                      MonoReflectionType* InValueReflectionType)
 {
-	const auto KeyProperty = FTypeBridge::Factory<>(InKeyReflectionType, nullptr, "", EObjectFlags::RF_Transient);
-
-	KeyProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
-
-	const auto ValueProperty =
-		FTypeBridge::Factory<>(InValueReflectionType, nullptr, "", EObjectFlags::RF_Transient);
+	const auto KeyProperty = FContainerElementPropertyCache::Get(InKeyReflectionType);
 
-	ValueProperty->SetPropertyFlags(CPF_HasGetValueTypeHash);
+	const auto ValueProperty = FContainerElementPropertyCache::Get(InValueReflectionType);
 
-	const auto ContainerHelper = new T(KeyProperty, ValueProperty, nullptr, true, true);
+	const auto ContainerHelper = new T(KeyProperty, ValueProperty, nullptr, true, false);
 
 	FCSharpEnvironment::GetEnvironment().AddContainerReference(ContainerHelper, InMonoObject);
 
@@ -839,7 +839,7 @@ FString FTypeBridge::GetPathName(MonoReflectionType* InReflectionType)
 	const auto PathNameMonoString = FMonoDomain::Object_To_String(
 		PathNameMonoObject, nullptr);
 
-	return UTF8_TO_TCHAR(FMonoDomain::String_To_UTF8(PathNameMonoString));
+	return FMonoDomain::String_To_FString(PathNameMonoString);
 }
 
 FString FTypeBridge::GetGenericPathName(MonoReflectionType* InReflectionType)
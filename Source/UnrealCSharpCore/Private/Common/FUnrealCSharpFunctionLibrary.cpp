@@ -868,6 +868,24 @@ bool FUnrealCSharpFunctionLibrary::IsGameField(const UField* InField)
 	return false;
 }
 
+bool FUnrealCSharpFunctionLibrary::IsBlittableStruct(const UScriptStruct* InScriptStruct)
+{
+	// Plain data math types are marshaled by value, aligned types such as FQuat or FTransform stay handle backed
+	static const TSet<FName> BlittableStructs{
+		TEXT("Vector"),
+		TEXT("Vector2D"),
+		TEXT("Rotator"),
+		TEXT("LinearColor"),
+		TEXT("Color"),
+		TEXT("IntPoint"),
+		TEXT("IntVector")
+	};
+
+	return InScriptStruct != nullptr &&
+		InScriptStruct->GetOutermost()->GetFName() == GLongCoreUObjectPackageName &&
+		BlittableStructs.Contains(InScriptStruct->GetFName());
+}
+
 #if WITH_EDITOR
 FString FUnrealCSharpFunctionLibrary::GetGenerationPath(const UField* InField)
 {
@@ -1032,6 +1050,21 @@ bool FUnrealCSharpFunctionLibrary::SaveStringToFile(const FString& InFileName, c
 		PlatformFile.CreateDirectoryTree(*DirectoryName);
 	}
 
+	// Rewriting an unchanged file would bump its timestamp and invalidate the incremental C# build
+	if (TArray<uint8> Bytes; FFileHelper::LoadFileToArray(Bytes, *InFileName, FILEREAD_Silent))
+	{
+		static constexpr uint8 UTF8BOM[] = {0xEF, 0xBB, 0xBF};
+
+		const FTCHARToUTF8 Converter(*InString, InString.Len());
+
+		if (Bytes.Num() == sizeof(UTF8BOM) + Converter.Length() &&
+			FMemory::Memcmp(Bytes.GetData(), UTF8BOM, sizeof(UTF8BOM)) == 0 &&
+			FMemory::Memcmp(Bytes.GetData() + sizeof(UTF8BOM), Converter.Get(), Converter.Length()) == 0)
+		{
+			return true;
+		}
+	}
+
 	const auto FileManager = &IFileManager::Get();
 
 	return FFileHelper::SaveStringToFile(InString, *InFileName, FFileHelper::EEncodingOptions::ForceUTF8, FileManager,
@@ -13,7 +13,10 @@
 #include "mono/metadata/mono-debug.h"
 #include "mono/metadata/class.h"
 #include "mono/metadata/reflection.h"
+#include "mono/metadata/threads.h"
 #include "Misc/FileHelper.h"
+#include "Hash/CityHash.h"
+#include <atomic>
 #include "Binding/FBinding.h"
 #include "Setting/UnrealCSharpSetting.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
@@ -31,10 +34,70 @@ TArray<MonoImage*> FMonoDomain::Images;
 
 bool FMonoDomain::bLoadSucceed;
 
+TMap<uint64, MonoClass*> FMonoDomain::ClassCache;
+
+TMap<TTuple<MonoClass*, uint64, int32>, MonoMethod*> FMonoDomain::MethodCache;
+
+TMap<MonoClass*, uint32> FMonoDomain::GarbageCollectionHandleOffsetCache;
+
+FCriticalSection FMonoDomain::CacheCriticalSection;
+
 #if PLATFORM_IOS
 extern void* mono_aot_module_System_Private_CoreLib_info;
 #endif
 
+namespace
+{
+	MonoAotMode GetAotMode()
+	{
+#if PLATFORM_LINUX && !WITH_EDITOR
+		if (const auto UnrealCSharpSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+			UUnrealCSharpSetting>())
+		{
+			switch (UnrealCSharpSetting->GetAotMode())
+			{
+			case EMonoAotMode::Normal:
+				return MONO_AOT_MODE_NORMAL;
+			case EMonoAotMode::Hybrid:
+				return MONO_AOT_MODE_HYBRID;
+			default:
+				break;
+			}
+		}
+#endif
+
+		return MONO_AOT_MODE_NONE;
+	}
+
+	std::atomic<uint32> ClassGeneration{1u};
+
+	uint64 GetNameHash(const FString& InName, const uint64 InSeed = 0)
+	{
+		return CityHash64WithSeed(reinterpret_cast<const char*>(*InName), InName.Len() * sizeof(TCHAR), InSeed);
+	}
+
+	// Guards the hashed caches against collisions without converting either name
+	bool IsName(const char* InName, const FString& InExpectedName)
+	{
+		if (InName == nullptr)
+		{
+			return false;
+		}
+
+		auto Index = 0;
+
+		for (; Index < InExpectedName.Len() && InName[Index] != '\0'; ++Index)
+		{
+			if (static_cast<TCHAR>(InName[Index]) != InExpectedName[Index])
+			{
+				return false;
+			}
+		}
+
+		return Index == InExpectedName.Len() && InName[Index] == '\0';
+	}
+}
+
 void FMonoDomain::Initialize(const FMonoDomainInitializeParams& InParams)
 {
 	RegisterMonoTrace();
@@ -62,7 +125,7 @@ void FMonoDomain::Initialize(const FMonoDomainInitializeParams& InParams)
 
 		setenv("DOTNET_SYSTEM_GLOBALIZATION_INVARIANT", "1", TRUE);
 #else
-		mono_jit_set_aot_mode(MONO_AOT_MODE_NONE);
+		mono_jit_set_aot_mode(GetAotMode());
 #endif
 
 		if (const auto UnrealCSharpSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
@@ -135,11 +198,32 @@ MonoVTable* FMonoDomain::Class_VTable(MonoClass* InMonoClass)
 
 MonoClass* FMonoDomain::Class_From_Name(const FString& InNameSpace, const FString& InMonoClassName)
 {
+	const auto Key = GetNameHash(InMonoClassName, GetNameHash(InNameSpace));
+
+	{
+		FScopeLock ScopeLock(&CacheCriticalSection);
+
+		if (const auto FoundClass = ClassCache.Find(Key);
+			FoundClass != nullptr &&
+			IsName(mono_class_get_name(*FoundClass), InMonoClassName) &&
+			IsName(mono_class_get_namespace(*FoundClass), InNameSpace))
+		{
+			return *FoundClass;
+		}
+	}
+
+	const auto NameSpace = StringCast<ANSICHAR>(*InNameSpace);
+
+	const auto MonoClassName = StringCast<ANSICHAR>(*InMonoClassName);
+
 	for (const auto& Image : Images)
 	{
-		if (const auto& Class = mono_class_from_name(Image, TCHAR_TO_ANSI(*InNameSpace),
-		                                             TCHAR_TO_ANSI(*InMonoClassName)))
+		if (const auto& Class = mono_class_from_name(Image, NameSpace.Get(), MonoClassName.Get()))
 		{
+			FScopeLock ScopeLock(&CacheCriticalSection);
+
+			ClassCache.Add(Key, Class);
+
 			return Class;
 		}
 	}
@@ -155,7 +239,28 @@ MonoMethod* FMonoDomain::Class_Get_Method_From_Name(MonoClass* InMonoClass, cons
 		return nullptr;
 	}
 
-	return mono_class_get_method_from_name(InMonoClass, TCHAR_TO_ANSI(*InFunctionName), InParamCount);
+	const auto Key = TTuple<MonoClass*, uint64, int32>(InMonoClass, GetNameHash(InFunctionName), InParamCount);
+
+	{
+		FScopeLock ScopeLock(&CacheCriticalSection);
+
+		if (const auto FoundMethod = MethodCache.Find(Key);
+			FoundMethod != nullptr && IsName(mono_method_get_name(*FoundMethod), InFunctionName))
+		{
+			return *FoundMethod;
+		}
+	}
+
+	const auto Method = mono_class_get_method_from_name(InMonoClass, TCHAR_TO_ANSI(*InFunctionName), InParamCount);
+
+	if (Method != nullptr)
+	{
+		FScopeLock ScopeLock(&CacheCriticalSection);
+
+		MethodCache.Add(Key, Method);
+	}
+
+	return Method;
 }
 
 mono_bool FMonoDomain::Class_Is_Subclass_Of(MonoClass* InMonoClass, MonoClass* InSuperMonoClass,
@@ -269,6 +374,11 @@ MonoType* FMonoDomain::Field_Get_Type(MonoClassField* InMonoClassField)
 	return InMonoClassField != nullptr ? mono_field_get_type(InMonoClassField) : nullptr;
 }
 
+uint32 FMonoDomain::Field_Get_Offset(MonoClassField* InMonoClassField)
+{
+	return InMonoClassField != nullptr ? mono_field_get_offset(InMonoClassField) : 0;
+}
+
 MonoObject* FMonoDomain::Field_Get_Value_Object(MonoDomain* InMonoDomain, MonoClassField* InMonoClassField,
                                                 MonoObject* InMonoObject)
 {
@@ -370,6 +480,11 @@ mono_bool FMonoDomain::Type_Is_ByRef(MonoType* InMonoType)
 	return mono_type_is_byref(InMonoType);
 }
 
+mono_bool FMonoDomain::Type_Is_Reference(MonoType* InMonoType)
+{
+	return mono_type_is_reference(InMonoType);
+}
+
 MonoReflectionMethod* FMonoDomain::Method_Get_Object(MonoMethod* InMethod, MonoClass* InMonoClass)
 {
 	return Domain != nullptr && InMethod != nullptr && InMonoClass != nullptr
@@ -477,6 +592,21 @@ char* FMonoDomain::String_To_UTF8(MonoString* InMonoString)
 	return InMonoString != nullptr ? mono_string_to_utf8(InMonoString) : nullptr;
 }
 
+MonoString* FMonoDomain::String_New_UTF16(const mono_unichar2* InText, const int32 InLength)
+{
+	return Domain != nullptr && InText != nullptr ? mono_string_new_utf16(Domain, InText, InLength) : nullptr;
+}
+
+mono_unichar2* FMonoDomain::String_Chars(MonoString* InMonoString)
+{
+	return InMonoString != nullptr ? mono_string_chars(InMonoString) : nullptr;
+}
+
+int32 FMonoDomain::String_Length(MonoString* InMonoString)
+{
+	return InMonoString != nullptr ? mono_string_length(InMonoString) : 0;
+}
+
 MonoArray* FMonoDomain::Array_New(MonoClass* InMonoClass, const uint32 InNum)
 {
 	return mono_array_new(Domain, InMonoClass, InNum);
@@ -592,11 +722,49 @@ void FMonoDomain::GCHandle_Free_V2(const MonoGCHandle InGCHandle)
 	return mono_gchandle_free_v2(InGCHandle);
 }
 
+int64 FMonoDomain::GC_Get_Allocated_Bytes_For_Current_Thread()
+{
+	typedef int64 (*GetAllocatedBytesForCurrentThreadType)(MonoObject**);
+
+	if (const auto FoundMonoClass = mono_class_from_name(mono_get_corlib(), "System", "GC"))
+	{
+		if (const auto FoundMonoMethod = mono_class_get_method_from_name(
+			FoundMonoClass, "GetAllocatedBytesForCurrentThread", 0))
+		{
+			// The thunk returns the counter unboxed, so reading it does not allocate on the managed heap
+			const auto GetAllocatedBytesForCurrentThread = (GetAllocatedBytesForCurrentThreadType)
+				Method_Get_Unmanaged_Thunk(FoundMonoMethod);
+
+			MonoObject* Exception{};
+
+			const auto AllocatedBytes = GetAllocatedBytesForCurrentThread(&Exception);
+
+			return Exception == nullptr ? AllocatedBytes : 0;
+		}
+	}
+
+	return 0;
+}
+
 void* FMonoDomain::Method_Get_Unmanaged_Thunk(MonoMethod* InMonoMethod)
 {
 	return mono_method_get_unmanaged_thunk(InMonoMethod);
 }
 
+MonoThread* FMonoDomain::Thread_Attach()
+{
+	// Threads the runtime already knows, such as the game thread, are left as they are
+	return Domain != nullptr && mono_domain_get() == nullptr ? mono_thread_attach(Domain) : nullptr;
+}
+
+void FMonoDomain::Thread_Detach(MonoThread* InMonoThread)
+{
+	if (InMonoThread != nullptr)
+	{
+		mono_thread_detach(InMonoThread);
+	}
+}
+
 void FMonoDomain::Class_Constructor(MonoClass* InMonoClass)
 {
 	if (const auto FoundMethod = Class_Get_Method_From_Name(InMonoClass, FUNCTION_CLASS_CONSTRUCTOR, 0))
@@ -646,6 +814,29 @@ MonoClassField* FMonoDomain::Self_Class_Get_Field_From_Name(MonoClass* InMonoCla
 	return nullptr;
 }
 
+uint32 FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(MonoClass* InMonoClass)
+{
+	FScopeLock ScopeLock(&CacheCriticalSection);
+
+	if (const auto FoundOffset = GarbageCollectionHandleOffsetCache.Find(InMonoClass))
+	{
+		return *FoundOffset;
+	}
+
+	// An object field never starts at 0 because of the object header, so 0 marks a class without the backing field
+	const auto Offset = Field_Get_Offset(
+		Class_Get_Field_From_Name(InMonoClass, PROPERTY_GARBAGE_COLLECTION_HANDLE_BACKING_FIELD));
+
+	GarbageCollectionHandleOffsetCache.Add(InMonoClass, Offset);
+
+	return Offset;
+}
+
+uint32 FMonoDomain::Get_Class_Generation()
+{
+	return ClassGeneration.load(std::memory_order_acquire);
+}
+
 MonoType* FMonoDomain::Property_Get_Type(MonoProperty* InMonoProperty)
 {
 	if (const auto Method = Property_Get_Get_Method(InMonoProperty))
@@ -755,6 +946,27 @@ mono_bool FMonoDomain::Type_Is_Enum(MonoType* InMonoType)
 	return false;
 }
 
+MonoString* FMonoDomain::String_New(const TCHAR* InText, const int32 InLength)
+{
+	// TCHAR is UTF-16 on every platform we ship, in which case StringCast only forwards the pointer
+	const auto Text = StringCast<UTF16CHAR>(InText, InLength);
+
+	return String_New_UTF16(reinterpret_cast<const mono_unichar2*>(Text.Get()), Text.Length());
+}
+
+FString FMonoDomain::String_To_FString(MonoString* InMonoString)
+{
+	if (InMonoString == nullptr)
+	{
+		return FString();
+	}
+
+	const auto Text = StringCast<TCHAR>(reinterpret_cast<const UTF16CHAR*>(String_Chars(InMonoString)),
+	                                    String_Length(InMonoString));
+
+	return FString(Text.Length(), Text.Get());
+}
+
 MonoAssembly* FMonoDomain::AssemblyPreloadHook(MonoAssemblyName* InAssemblyName, char** OutAssemblyPath,
                                                void* InUserData)
 {
@@ -843,6 +1055,8 @@ void FMonoDomain::DeinitializeAssembly()
 #if WITH_EDITOR
 	DeinitializeAssemblyLoadContext();
 #endif
+
+	ResetCache();
 }
 
 void FMonoDomain::InitializeAssemblyLoadContext()
@@ -978,7 +1192,11 @@ void FMonoDomain::LoadAssembly(const TArray<FString>& InAssemblies)
 
 		MonoAssembly* Assembly = nullptr;
 
-		LoadAssembly(FPaths::GetBaseFilename(AssemblyPath), AssemblyPath, &Image, &Assembly);
+		// The runtime looks for the precompiled image next to the path the image is named after
+		LoadAssembly(GetAotMode() != MONO_AOT_MODE_NONE
+			             ? FPaths::ConvertRelativePathToFull(AssemblyPath)
+			             : FPaths::GetBaseFilename(AssemblyPath),
+		             AssemblyPath, &Image, &Assembly);
 
 		if (Image != nullptr)
 		{
@@ -1019,6 +1237,8 @@ void FMonoDomain::UnloadAssembly()
 
 	Assemblies.Reset();
 
+	ResetCache();
+
 	bLoadSucceed = false;
 }
 
@@ -1061,3 +1281,16 @@ void FMonoDomain::RegisterBinding()
 		}
 	}
 }
+
+void FMonoDomain::ResetCache()
+{
+	ClassGeneration.fetch_add(1u, std::memory_order_release);
+
+	FScopeLock ScopeLock(&CacheCriticalSection);
+
+	ClassCache.Reset();
+
+	MethodCache.Reset();
+
+	GarbageCollectionHandleOffsetCache.Reset();
+}
@@ -26,6 +26,8 @@ TMap<FString, UClass*> FDynamicClassGenerator::DynamicClassMap;
 
 TSet<UClass*> FDynamicClassGenerator::DynamicClassSet;
 
+TMap<UClass*, FDynamicClassGenerator::FClassConstructorPlan> FDynamicClassGenerator::ClassConstructorPlanMap;
+
 void FDynamicClassGenerator::Generator()
 {
 	FDynamicGeneratorCore::Generator(CLASS_U_CLASS_ATTRIBUTE,
@@ -43,10 +45,15 @@ void FDynamicClassGenerator::Generator()
 
 		                                 const auto ClassName = FString(FMonoDomain::Class_Get_Name(InMonoClass));
 
-		                                 auto Node = FDynamicDependencyGraph::FNode(ClassName, [InMonoClass]()
-		                                 {
-			                                 Generator(InMonoClass);
-		                                 });
+		                                 auto Node = FDynamicDependencyGraph::FNode(
+			                                 ClassName, [InMonoClass]()
+			                                 {
+				                                 FDynamicGeneratorCore::Prepare(InMonoClass);
+			                                 },
+			                                 [InMonoClass]()
+			                                 {
+				                                 Generator(InMonoClass);
+			                                 });
 
 		                                 if (const auto ParentMonoClass = FMonoDomain::Class_Get_Parent(InMonoClass))
 		                                 {
@@ -193,6 +200,8 @@ void FDynamicClassGenerator::Generator(MonoClass* InMonoClass)
 
 		DynamicClassSet.Remove(OldClass);
 
+		ClassConstructorPlanMap.Remove(OldClass);
+
 		if (const auto BlueprintGeneratedClass = Cast<UBlueprintGeneratedClass>(OldClass))
 		{
 			if (const auto Blueprint = Cast<UBlueprint>(BlueprintGeneratedClass->ClassGeneratedBy))
@@ -289,6 +298,17 @@ UClass* FDynamicClassGenerator::GetDynamicClass(MonoClass* InMonoClass)
 	return FoundDynamicClass != nullptr ? *FoundDynamicClass : nullptr;
 }
 
+void FDynamicClassGenerator::UpdateClassConstructor(const UClass* InClass)
+{
+	for (auto& [Key, Value] : ClassConstructorPlanMap)
+	{
+		if (Key->IsChildOf(InClass))
+		{
+			ResolveClassConstructor(Key, Value);
+		}
+	}
+}
+
 void FDynamicClassGenerator::BeginGenerator(UClass* InClass, UClass* InParentClass)
 {
 	InClass->PropertyLink = InParentClass->PropertyLink;
@@ -342,6 +362,8 @@ void FDynamicClassGenerator::EndGenerator(UClass* InClass)
 
 	InClass->AssembleReferenceTokenStream();
 
+	GeneratorClassConstructorPlan(InClass);
+
 	InClass->ClassDefaultObject = StaticAllocateObject(InClass, InClass->GetOuter(),
 	                                                   *InClass->GetDefaultObjectName().ToString(),
 	                                                   RF_Public | RF_ClassDefaultObject | RF_ArchetypeObject,
@@ -533,6 +555,15 @@ void FDynamicClassGenerator::ReInstance(UClass* InOldClass, UClass* InNewClass)
 		}
 	}
 
+	// The plans of derived dynamic classes still point at the properties of the old class
+	for (const auto DynamicClass : DynamicClassSet)
+	{
+		if (DynamicClass->IsChildOf(InNewClass) && DynamicClass != InNewClass)
+		{
+			GeneratorClassConstructorPlan(DynamicClass);
+		}
+	}
+
 	if (const auto BlueprintGeneratedClass = Cast<UBlueprintGeneratedClass>(InOldClass))
 	{
 		if (const auto Blueprint = Cast<UBlueprint>(BlueprintGeneratedClass->ClassGeneratedBy))
@@ -631,27 +662,128 @@ void FDynamicClassGenerator::GeneratorInterface(MonoClass* InMonoClass, UClass*
 	}
 }
 
-void FDynamicClassGenerator::ClassConstructor(const FObjectInitializer& InObjectInitializer)
+void FDynamicClassGenerator::GeneratorClassConstructorPlan(UClass* InClass)
 {
-	const auto Object = InObjectInitializer.GetObj();
+	auto& ClassConstructorPlan = ClassConstructorPlanMap.Add(InClass);
 
-	auto SuperClass = InObjectInitializer.GetClass();
+	TArray<TPair<int32, int32>> ZeroInitializeRanges;
 
-	while (SuperClass != nullptr)
+	for (auto SuperClass = InClass; SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
 	{
 		if (IsDynamicClass(SuperClass))
 		{
 			for (TFieldIterator<FProperty> It(SuperClass, EFieldIteratorFlags::ExcludeSuper,
 			                                  EFieldIteratorFlags::ExcludeDeprecated); It; ++It)
 			{
-				It->InitializeValue(It->ContainerPtrToValuePtr<void>(Object));
+				if (It->HasAnyPropertyFlags(CPF_ZeroConstructor))
+				{
+					ZeroInitializeRanges.Emplace(It->GetOffset_ForInternal(), It->GetSize());
+				}
+				else
+				{
+					ClassConstructorPlan.InitializeProperties.Add(*It);
+				}
 			}
 		}
+	}
 
-		SuperClass = SuperClass->GetSuperClass();
+	ZeroInitializeRanges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (const auto& [Offset, Size] : ZeroInitializeRanges)
+	{
+		if (ClassConstructorPlan.ZeroInitializeRanges.Num() > 0)
+		{
+			if (auto& [LastOffset, LastSize] = ClassConstructorPlan.ZeroInitializeRanges.Last();
+				LastOffset + LastSize >= Offset)
+			{
+				LastSize = FMath::Max(LastSize, Offset + Size - LastOffset);
+
+				continue;
+			}
+		}
+
+		ClassConstructorPlan.ZeroInitializeRanges.Emplace(Offset, Size);
 	}
 
-	SuperClass = InObjectInitializer.GetClass();
+	ResolveClassConstructor(InClass, ClassConstructorPlan);
+}
+
+void FDynamicClassGenerator::ResolveClassConstructor(UClass* InClass, FClassConstructorPlan& OutClassConstructorPlan)
+{
+	OutClassConstructorPlan.ConstructorClass = nullptr;
+
+	OutClassConstructorPlan.ClassConstructor = nullptr;
+
+	for (auto SuperClass = InClass; SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+	{
+		if (SuperClass->ClassConstructor != nullptr && !ClassConstructorSet.Contains(SuperClass->ClassConstructor))
+		{
+			OutClassConstructorPlan.ConstructorClass = SuperClass;
+
+			OutClassConstructorPlan.ClassConstructor = SuperClass->ClassConstructor;
+
+			break;
+		}
+	}
+}
+
+void FDynamicClassGenerator::ClassConstructor(const FObjectInitializer& InObjectInitializer)
+{
+	const auto Object = InObjectInitializer.GetObj();
+
+	// Blueprint classes derived from a dynamic class share its constructor and its plan
+	const FClassConstructorPlan* ClassConstructorPlan{};
+
+	for (auto Class = InObjectInitializer.GetClass(); Class != nullptr && ClassConstructorPlan == nullptr;
+	     Class = Class->GetSuperClass())
+	{
+		ClassConstructorPlan = ClassConstructorPlanMap.Find(Class);
+	}
+
+	if (ClassConstructorPlan != nullptr)
+	{
+		for (const auto& [Offset, Size] : ClassConstructorPlan->ZeroInitializeRanges)
+		{
+			FMemory::Memzero(reinterpret_cast<uint8*>(Object) + Offset, Size);
+		}
+
+		for (const auto Property : ClassConstructorPlan->InitializeProperties)
+		{
+			Property->InitializeValue(Property->ContainerPtrToValuePtr<void>(Object));
+		}
+
+		// A constructor replaced after the plan was built falls back to resolving it again
+		if (ClassConstructorPlan->ConstructorClass != nullptr &&
+			ClassConstructorPlan->ConstructorClass->ClassConstructor == ClassConstructorPlan->ClassConstructor)
+		{
+			ClassConstructorPlan->ClassConstructor(InObjectInitializer);
+
+			return;
+		}
+	}
+	else
+	{
+		auto SuperClass = InObjectInitializer.GetClass();
+
+		while (SuperClass != nullptr)
+		{
+			if (IsDynamicClass(SuperClass))
+			{
+				for (TFieldIterator<FProperty> It(SuperClass, EFieldIteratorFlags::ExcludeSuper,
+				                                  EFieldIteratorFlags::ExcludeDeprecated); It; ++It)
+				{
+					It->InitializeValue(It->ContainerPtrToValuePtr<void>(Object));
+				}
+			}
+
+			SuperClass = SuperClass->GetSuperClass();
+		}
+	}
+
+	auto SuperClass = InObjectInitializer.GetClass();
 
 	while (SuperClass != nullptr)
 	{
@@ -1,5 +1,25 @@
 #include "Dynamic/FDynamicDependencyGraph.h"
 #include "CoreMacro/Macro.h"
+#include "Log/UnrealCSharpLog.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	int32 GetPrefixPriority(const FString& InName)
+	{
+		static const TArray<FString> Prefixes{ACTOR_PREFIX, OBJECT_PREFIX, STRUCT_PREFIX};
+
+		for (auto Index = 0; Index < Prefixes.Num(); ++Index)
+		{
+			if (InName.StartsWith(Prefixes[Index], ESearchCase::CaseSensitive))
+			{
+				return Index;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+}
 
 FDynamicDependencyGraph& FDynamicDependencyGraph::Get()
 {
@@ -10,30 +30,23 @@ FDynamicDependencyGraph& FDynamicDependencyGraph::Get()
 
 void FDynamicDependencyGraph::AddNode(const FNode& InNode)
 {
-	Nodes.Emplace(InNode.Name, InNode);
-}
-
-bool FDynamicDependencyGraph::IsCompleted(const FString& InName)
-{
-	static auto A = ACTOR_PREFIX;
-
-	static auto U = OBJECT_PREFIX;
-
-	static auto F = STRUCT_PREFIX;
-
-	if (auto FoundNode = Nodes.Find(InName))
+	if (const auto FoundIndex = NodeIndices.Find(InNode.Name))
 	{
-		return FoundNode->IsCompleted();
+		Nodes[*FoundIndex] = InNode;
 	}
-	else if (FoundNode = Nodes.Find(A + InName); FoundNode != nullptr)
+	else
 	{
-		return FoundNode->IsCompleted();
-	}
-	else if (FoundNode = Nodes.Find(U + InName); FoundNode != nullptr)
-	{
-		return FoundNode->IsCompleted();
+		const auto Index = Nodes.Add(InNode);
+
+		NodeIndices.Add(InNode.Name, Index);
+
+		AddNodeAlias(InNode.Name, Index);
 	}
-	else if (FoundNode = Nodes.Find(F + InName); FoundNode != nullptr)
+}
+
+bool FDynamicDependencyGraph::IsCompleted(const FString& InName)
+{
+	if (const auto FoundNode = FindNode(InName))
 	{
 		return FoundNode->IsCompleted();
 	}
@@ -43,146 +56,157 @@ bool FDynamicDependencyGraph::IsCompleted(const FString& InName)
 
 void FDynamicDependencyGraph::Completed(const FString& InName)
 {
-	if (const auto FoundNode = Nodes.Find(InName))
+	if (const auto FoundIndex = NodeIndices.Find(InName))
 	{
-		FoundNode->Completed();
+		Nodes[*FoundIndex].Completed();
 	}
 }
 
 void FDynamicDependencyGraph::OnCompleted(const FString& InName, const TFunction<void()>& InOnCompleted)
 {
-	static auto A = ACTOR_PREFIX;
-
-	static auto U = OBJECT_PREFIX;
-
-	static auto F = STRUCT_PREFIX;
-
-	if (auto FoundNode = Nodes.Find(InName))
+	if (const auto FoundNode = FindNode(InName))
 	{
 		FoundNode->OnCompleted.Add(InOnCompleted);
 	}
-	else if (FoundNode = Nodes.Find(A + InName); FoundNode != nullptr)
+}
+
+void FDynamicDependencyGraph::Generator()
+{
+	const auto NodeNum = Nodes.Num();
+
+	TArray<int32> DependencyCounts;
+
+	DependencyCounts.Init(0, NodeNum);
+
+	TArray<TArray<int32>> Dependents;
+
+	Dependents.SetNum(NodeNum);
+
+	for (auto Index = 0; Index < NodeNum; ++Index)
 	{
-		FoundNode->OnCompleted.Add(InOnCompleted);
+		if (Nodes[Index].IsCompleted())
+		{
+			continue;
+		}
+
+		for (const auto& [Dependency, bIsSoftReference] : Nodes[Index].Dependencies)
+		{
+			if (bIsSoftReference)
+			{
+				continue;
+			}
+
+			if (const auto FoundIndex = NodeIndices.Find(Dependency);
+				FoundIndex != nullptr && *FoundIndex != Index && !Nodes[*FoundIndex].IsCompleted())
+			{
+				Dependents[*FoundIndex].Add(Index);
+
+				++DependencyCounts[Index];
+			}
+		}
 	}
-	else if (FoundNode = Nodes.Find(U + InName); FoundNode != nullptr)
+
+	const auto SortByName = [this](const int32 A, const int32 B)
 	{
-		FoundNode->OnCompleted.Add(InOnCompleted);
-	}
-	else if (FoundNode = Nodes.Find(F + InName); FoundNode != nullptr)
+		return Nodes[A].Name < Nodes[B].Name;
+	};
+
+	TArray<int32> Level;
+
+	for (auto Index = 0; Index < NodeNum; ++Index)
 	{
-		FoundNode->OnCompleted.Add(InOnCompleted);
+		if (!Nodes[Index].IsCompleted() && DependencyCounts[Index] == 0)
+		{
+			Level.Add(Index);
+		}
 	}
-}
 
-void FDynamicDependencyGraph::Generator()
-{
-	for (auto& [Name, PLACEHOLDER] : Nodes)
+	// Every node of a level only depends on earlier levels, nodes caught in a cycle are never reached
+	while (!Level.IsEmpty())
 	{
-		if (Nodes[Name].IsCompleted())
+		Level.Sort(SortByName);
+
+		ParallelFor(Level.Num(), [this, &Level](const int32 Index)
 		{
-			// @TODO
-		}
-		else
+			Nodes[Level[Index]].Prepare();
+		});
+
+		for (const auto Index : Level)
 		{
-			TArray<FString> NodeStack{Name};
+			Nodes[Index].Pending();
 
-			TQueue<FString> NodeQueue;
+			Nodes[Index].Generator();
+		}
 
-			TSet<FString> NodeSet;
+		TArray<int32> NextLevel;
 
-			while (!NodeStack.IsEmpty())
+		for (const auto Index : Level)
+		{
+			for (const auto Dependent : Dependents[Index])
 			{
-				if (const auto& Node = NodeStack.Pop();
-					NodeSet.Contains(Node))
-				{
-					// @TODO
-				}
-				else
+				if (--DependencyCounts[Dependent] == 0)
 				{
-					auto bIsCompleted = true;
-
-					for (const auto& [Dependency, bIsSoftReference] : Nodes[Node].Dependencies)
-					{
-						if (Nodes[Dependency].IsPending())
-						{
-							if (!bIsSoftReference)
-							{
-								bIsCompleted = false;
-							}
-						}
-						else if (Nodes[Dependency].IsInitial())
-						{
-							if (!bIsSoftReference)
-							{
-								Nodes[Dependency].Pending();
-
-								NodeStack.Push(Dependency);
-
-								bIsCompleted = false;
-							}
-						}
-					}
-
-					if (bIsCompleted)
-					{
-						Nodes[Node].Generator();
-					}
-					else
-					{
-						Nodes[Node].Pending();
-
-						NodeQueue.Enqueue(Node);
-
-						NodeSet.Add(Node);
-					}
+					NextLevel.Add(Dependent);
 				}
 			}
+		}
 
-			FString OutNode;
+		Level = MoveTemp(NextLevel);
+	}
 
-			while (NodeQueue.Dequeue(OutNode))
-			{
-				auto bIsPending = false;
+	TArray<FString> UncompletedNodes;
 
-				auto bIsCompleted = true;
+	for (const auto& Node : Nodes)
+	{
+		if (!Node.IsCompleted())
+		{
+			UncompletedNodes.Add(Node.Name);
+		}
+	}
 
-				for (const auto& [Dependency, bIsSoftReference] : Nodes[OutNode].Dependencies)
-				{
-					if (!bIsSoftReference)
-					{
-						if (Nodes[Dependency].IsInitial())
-						{
-							bIsCompleted = false;
-
-							break;
-						}
-
-						if (Nodes[Dependency].IsPending())
-						{
-							bIsPending = true;
-
-							break;
-						}
-					}
-				}
+	if (!UncompletedNodes.IsEmpty())
+	{
+		UncompletedNodes.Sort();
 
-				if (bIsPending)
-				{
-					NodeQueue.Enqueue(OutNode);
+		UE_LOG(LogUnrealCSharp, Error, TEXT("Dynamic types were not generated, check them for dependency cycles: %s"),
+		       *FString::Join(UncompletedNodes, TEXT(", ")));
+	}
+}
 
-					continue;
-				}
+FDynamicDependencyGraph::FNode* FDynamicDependencyGraph::FindNode(const FString& InName)
+{
+	if (const auto FoundIndex = NodeIndices.Find(InName))
+	{
+		return &Nodes[*FoundIndex];
+	}
 
-				if (bIsCompleted)
-				{
-					Nodes[OutNode].Generator();
-				}
-				else
-				{
-					// @TODO
-				}
-			}
+	if (const auto FoundIndex = NodeAliases.Find(InName))
+	{
+		return &Nodes[*FoundIndex];
+	}
+
+	return nullptr;
+}
+
+void FDynamicDependencyGraph::AddNodeAlias(const FString& InName, const int32 InIndex)
+{
+	const auto PrefixPriority = GetPrefixPriority(InName);
+
+	if (PrefixPriority == INDEX_NONE)
+	{
+		return;
+	}
+
+	const auto Alias = InName.RightChop(1);
+
+	// The previous lookup tried the A, U and F prefixes in this order
+	if (const auto FoundIndex = NodeAliases.Find(Alias))
+	{
+		if (GetPrefixPriority(Nodes[*FoundIndex].Name) <= PrefixPriority)
+		{
+			return;
 		}
 	}
+
+	NodeAliases.Add(Alias, InIndex);
 }
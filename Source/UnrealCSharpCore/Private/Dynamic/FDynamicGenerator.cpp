@@ -21,6 +21,8 @@ void FDynamicGenerator::Generator()
 
 	FMonoDomainScope([]()
 	{
+		FDynamicGeneratorCore::BeginGenerator();
+
 		FDynamicEnumGenerator::Generator();
 
 		FDynamicStructGenerator::Generator();
@@ -30,6 +32,8 @@ void FDynamicGenerator::Generator()
 		FDynamicClassGenerator::Generator();
 
 		FDynamicGeneratorCore::Generator();
+
+		FDynamicGeneratorCore::EndGenerator();
 	});
 
 #if WITH_EDITOR
@@ -107,6 +111,8 @@ void FDynamicGenerator::Generator(const TArray<FFileChangeData>& FileChangeData)
 {
 	FMonoDomainScope([FileChangeData]()
 	{
+		FDynamicGeneratorCore::BeginGenerator();
+
 		TArray<FString> FileChange;
 
 		for (const auto& Data : FileChangeData)
@@ -133,6 +139,8 @@ void FDynamicGenerator::Generator(const TArray<FFileChangeData>& FileChangeData)
 				FDynamicInterfaceGenerator::Generator(Class);
 			}
 		}
+
+		FDynamicGeneratorCore::EndGenerator();
 	});
 }
 
@@ -18,6 +18,14 @@
 #include "Template/TGetArrayLength.inl"
 #include "mono/metadata/object.h"
 
+FDynamicGeneratorCore::FWellKnownClasses FDynamicGeneratorCore::WellKnownClasses;
+
+TMap<MonoClass*, FDynamicGeneratorCore::EFieldKind> FDynamicGeneratorCore::FieldKindMap;
+
+TMap<MonoClass*, TUniquePtr<FDynamicGeneratorCore::FClassDescriptor>> FDynamicGeneratorCore::ClassDescriptorMap;
+
+FCriticalSection FDynamicGeneratorCore::ClassDescriptorCriticalSection;
+
 #if WITH_EDITOR
 TMap<FString, TArray<FString>> FDynamicGeneratorCore::DynamicMap;
 
@@ -256,6 +264,20 @@ const FString& FDynamicGeneratorCore::DynamicReInstanceBaseName()
 }
 #endif
 
+void FDynamicGeneratorCore::BeginGenerator()
+{
+	(void)GetWellKnownClasses();
+}
+
+void FDynamicGeneratorCore::EndGenerator()
+{
+	WellKnownClasses = FWellKnownClasses();
+
+	FieldKindMap.Empty();
+
+	ClassDescriptorMap.Empty();
+}
+
 void FDynamicGeneratorCore::AddNode(const FDynamicDependencyGraph::FNode& InNode)
 {
 	FDynamicDependencyGraph::Get().AddNode(InNode);
@@ -289,142 +311,44 @@ void FDynamicGeneratorCore::GeneratorField(MonoReflectionType* InMonoReflectionT
 
 	const auto InMonoClass = FMonoDomain::Type_Get_Class(InMonoType);
 
-	const auto ClassName = FString(FMonoDomain::Class_Get_Name(InMonoClass));
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_SUB_CLASS_OF))
+	switch (GetFieldKind(InMonoClass))
 	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
+	case EFieldKind::Generic:
 		{
 			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
 
-			return;
+			break;
 		}
-	}
 
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		FUnrealCSharpFunctionLibrary::GetClassNameSpace(UObject::StaticClass()),
-		FUnrealCSharpFunctionLibrary::GetFullClass(UObject::StaticClass())))
-	{
-		if (InMonoClass == FoundMonoClass ||
-			FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			if (ClassHasAttr(InMonoClass, CLASS_U_CLASS_ATTRIBUTE))
-			{
-				OutNode.Dependency(FDynamicDependencyGraph::FDependency{ClassName, true});
-			}
-
-			return;
-		}
-	}
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_SCRIPT_INTERFACE))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
+	case EFieldKind::GenericPair:
 		{
 			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
 
-			return;
-		}
-	}
-
-	if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FMonoDomain::Get_Enum_Class(), false))
-	{
-		if (ClassHasAttr(InMonoClass, CLASS_U_ENUM_ATTRIBUTE))
-		{
-			OutNode.Dependency(FDynamicDependencyGraph::FDependency{ClassName, false});
-		}
-
-		return;
-	}
-
-	if (FMonoDomain::Class_Get_Method_From_Name(
-		InMonoClass, FUNCTION_STATIC_STRUCT, 0))
-	{
-		if (ClassHasAttr(InMonoClass, CLASS_U_STRUCT_ATTRIBUTE))
-		{
-			OutNode.Dependency(FDynamicDependencyGraph::FDependency{ClassName, false});
-		}
-
-		return;
-	}
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_WEAK_OBJECT_PTR))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
-
-			return;
-		}
-	}
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_LAZY_OBJECT_PTR))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
-
-			return;
-		}
-	}
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_SOFT_CLASS_PTR))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
-
-			return;
-		}
-	}
-
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_SOFT_OBJECT_PTR))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
+			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType, 1), OutNode);
 
-			return;
+			break;
 		}
-	}
 
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_MAP))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
+	case EFieldKind::SoftDependency:
 		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
+			OutNode.Dependency(FDynamicDependencyGraph::FDependency{
+				FString(FMonoDomain::Class_Get_Name(InMonoClass)), true
+			});
 
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType, 1), OutNode);
-
-			return;
+			break;
 		}
-	}
 
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_SET))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
+	case EFieldKind::Dependency:
 		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
+			OutNode.Dependency(FDynamicDependencyGraph::FDependency{
+				FString(FMonoDomain::Class_Get_Name(InMonoClass)), false
+			});
 
-			return;
+			break;
 		}
-	}
 
-	if (const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), GENERIC_T_ARRAY))
-	{
-		if (FMonoDomain::Class_Is_Subclass_Of(InMonoClass, FoundMonoClass, false))
-		{
-			GeneratorField(FTypeBridge::GetGenericArgument(InMonoReflectionType), OutNode);
-		}
+	default:
+		break;
 	}
 }
 
@@ -435,8 +359,7 @@ void FDynamicGeneratorCore::GeneratorProperty(MonoClass* InMonoClass, FDynamicDe
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_PROPERTY_ATTRIBUTE);
+	const auto AttributeMonoClass = GetWellKnownClasses().UPropertyAttribute;
 
 	void* Iterator = nullptr;
 
@@ -463,8 +386,7 @@ void FDynamicGeneratorCore::GeneratorFunction(MonoClass* InMonoClass, FDynamicDe
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_FUNCTION_ATTRIBUTE);
+	const auto AttributeMonoClass = GetWellKnownClasses().UFunctionAttribute;
 
 	void* MethodIterator = nullptr;
 
@@ -496,8 +418,7 @@ void FDynamicGeneratorCore::GeneratorInterface(MonoClass* InMonoClass, FDynamicD
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_INTERFACE_ATTRIBUTE);
+	const auto AttributeMonoClass = GetWellKnownClasses().UInterfaceAttribute;
 
 	void* Iterator = nullptr;
 
@@ -515,11 +436,255 @@ void FDynamicGeneratorCore::GeneratorInterface(MonoClass* InMonoClass, FDynamicD
 	}
 }
 
+void FDynamicGeneratorCore::Prepare(MonoClass* InMonoClass)
+{
+	if (InMonoClass == nullptr)
+	{
+		return;
+	}
+
+	const auto MonoThread = FMonoDomain::Thread_Attach();
+
+	auto ClassDescriptor = MakeUnique<FClassDescriptor>(GetClassDescriptor(InMonoClass));
+
+	FMonoDomain::Thread_Detach(MonoThread);
+
+	FScopeLock ScopeLock(&ClassDescriptorCriticalSection);
+
+	ClassDescriptorMap.Add(InMonoClass, MoveTemp(ClassDescriptor));
+}
+
 bool FDynamicGeneratorCore::ClassHasAttr(MonoClass* InMonoClass, const FString& InAttributeName)
 {
 	return AttrsHasAttr(FMonoDomain::Custom_Attrs_From_Class(InMonoClass), InAttributeName);
 }
 
+const FDynamicGeneratorCore::FWellKnownClasses& FDynamicGeneratorCore::GetWellKnownClasses()
+{
+	if (!WellKnownClasses.bIsInitialized)
+	{
+		const auto CoreUObjectNameSpace = COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT);
+
+		const auto DynamicNameSpace = COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC);
+
+		WellKnownClasses.SubclassOf = FMonoDomain::Class_From_Name(CoreUObjectNameSpace, GENERIC_T_SUB_CLASS_OF);
+
+		WellKnownClasses.Object = FMonoDomain::Class_From_Name(
+			FUnrealCSharpFunctionLibrary::GetClassNameSpace(UObject::StaticClass()),
+			FUnrealCSharpFunctionLibrary::GetFullClass(UObject::StaticClass()));
+
+		WellKnownClasses.ScriptInterface = FMonoDomain::Class_From_Name(
+			CoreUObjectNameSpace, GENERIC_T_SCRIPT_INTERFACE);
+
+		WellKnownClasses.Enum = FMonoDomain::Get_Enum_Class();
+
+		WellKnownClasses.WeakObjectPtr = FMonoDomain::Class_From_Name(
+			CoreUObjectNameSpace, GENERIC_T_WEAK_OBJECT_PTR);
+
+		WellKnownClasses.LazyObjectPtr = FMonoDomain::Class_From_Name(
+			CoreUObjectNameSpace, GENERIC_T_LAZY_OBJECT_PTR);
+
+		WellKnownClasses.SoftClassPtr = FMonoDomain::Class_From_Name(
+			CoreUObjectNameSpace, GENERIC_T_SOFT_CLASS_PTR);
+
+		WellKnownClasses.SoftObjectPtr = FMonoDomain::Class_From_Name(
+			CoreUObjectNameSpace, GENERIC_T_SOFT_OBJECT_PTR);
+
+		WellKnownClasses.Map = FMonoDomain::Class_From_Name(CoreUObjectNameSpace, GENERIC_T_MAP);
+
+		WellKnownClasses.Set = FMonoDomain::Class_From_Name(CoreUObjectNameSpace, GENERIC_T_SET);
+
+		WellKnownClasses.Array = FMonoDomain::Class_From_Name(CoreUObjectNameSpace, GENERIC_T_ARRAY);
+
+		WellKnownClasses.UClassAttribute = FMonoDomain::Class_From_Name(DynamicNameSpace, CLASS_U_CLASS_ATTRIBUTE);
+
+		WellKnownClasses.UStructAttribute = FMonoDomain::Class_From_Name(DynamicNameSpace, CLASS_U_STRUCT_ATTRIBUTE);
+
+		WellKnownClasses.UEnumAttribute = FMonoDomain::Class_From_Name(DynamicNameSpace, CLASS_U_ENUM_ATTRIBUTE);
+
+		WellKnownClasses.UInterfaceAttribute = FMonoDomain::Class_From_Name(
+			DynamicNameSpace, CLASS_U_INTERFACE_ATTRIBUTE);
+
+		WellKnownClasses.UPropertyAttribute = FMonoDomain::Class_From_Name(
+			DynamicNameSpace, CLASS_U_PROPERTY_ATTRIBUTE);
+
+		WellKnownClasses.UFunctionAttribute = FMonoDomain::Class_From_Name(
+			DynamicNameSpace, CLASS_U_FUNCTION_ATTRIBUTE);
+
+		WellKnownClasses.bIsInitialized = true;
+	}
+
+	return WellKnownClasses;
+}
+
+MonoClass* FDynamicGeneratorCore::GetAttributeClass(const FString& InAttributeName)
+{
+	if (const auto FoundAttribute = WellKnownClasses.Attributes.Find(InAttributeName))
+	{
+		return *FoundAttribute;
+	}
+
+	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
+		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), InAttributeName);
+
+	return WellKnownClasses.Attributes.Add(InAttributeName, AttributeMonoClass);
+}
+
+FDynamicGeneratorCore::FClassDescriptor FDynamicGeneratorCore::GetClassDescriptor(MonoClass* InMonoClass)
+{
+	FClassDescriptor ClassDescriptor;
+
+	const auto& Classes = GetWellKnownClasses();
+
+	void* PropertyIterator = nullptr;
+
+	while (const auto Property = FMonoDomain::Class_Get_Properties(InMonoClass, &PropertyIterator))
+	{
+		if (const auto Attrs = FMonoDomain::Custom_Attrs_From_Property(InMonoClass, Property))
+		{
+			if (!!FMonoDomain::Custom_Attrs_Has_Attr(Attrs, Classes.UPropertyAttribute))
+			{
+				ClassDescriptor.PropertyDescriptors.Add({
+					Attrs,
+					FMonoDomain::Property_Get_Name(Property),
+					FMonoDomain::Type_Get_Object(FMonoDomain::Property_Get_Type(Property))
+				});
+			}
+		}
+	}
+
+	void* MethodIterator = nullptr;
+
+	while (const auto Method = FMonoDomain::Class_Get_Methods(InMonoClass, &MethodIterator))
+	{
+		if (const auto Attrs = FMonoDomain::Custom_Attrs_From_Method(Method))
+		{
+			if (!!FMonoDomain::Custom_Attrs_Has_Attr(Attrs, Classes.UFunctionAttribute))
+			{
+				const auto Signature = FMonoDomain::Method_Signature(Method);
+
+				const auto ReturnParamType = FMonoDomain::Signature_Get_Return_Type(Signature);
+
+				auto& FunctionDescriptor = ClassDescriptor.FunctionDescriptors.Add_GetRef({
+					Attrs,
+					FMonoDomain::Method_Get_Name(Method),
+					!!!FMonoDomain::Signature_Is_Instance(Signature),
+					ReturnParamType != nullptr ? FMonoDomain::Type_Get_Object(ReturnParamType) : nullptr
+				});
+
+				void* ParamIterator = nullptr;
+
+				const auto ParamCount = FMonoDomain::Signature_Get_Param_Count(Signature);
+
+				const auto ParamNames = static_cast<const char**>(FMemory_Alloca(ParamCount * sizeof(const char*)));
+
+				FMonoDomain::Method_Get_Param_Names(Method, ParamNames);
+
+				auto ParamIndex = 0;
+
+				while (const auto Param = FMonoDomain::Signature_Get_Params(Signature, &ParamIterator))
+				{
+					FunctionDescriptor.ParamDescriptors.Add({
+						FMonoDomain::Type_Get_Object(Param),
+						ParamNames[ParamIndex++],
+						!!FMonoDomain::Type_Is_ByRef(Param)
+					});
+				}
+			}
+		}
+	}
+
+	return ClassDescriptor;
+}
+
+const FDynamicGeneratorCore::FClassDescriptor& FDynamicGeneratorCore::FindOrAddClassDescriptor(
+	MonoClass* InMonoClass)
+{
+	FScopeLock ScopeLock(&ClassDescriptorCriticalSection);
+
+	// Types generated outside of the dependency graph, such as on file changes, are not prepared
+	if (const auto FoundClassDescriptor = ClassDescriptorMap.Find(InMonoClass))
+	{
+		return **FoundClassDescriptor;
+	}
+
+	return *ClassDescriptorMap.Add(InMonoClass, MakeUnique<FClassDescriptor>(GetClassDescriptor(InMonoClass)));
+}
+
+FDynamicGeneratorCore::EFieldKind FDynamicGeneratorCore::GetFieldKind(MonoClass* InMonoClass)
+{
+	if (const auto FoundFieldKind = FieldKindMap.Find(InMonoClass))
+	{
+		return *FoundFieldKind;
+	}
+
+	const auto& Classes = GetWellKnownClasses();
+
+	const auto IsSubclassOf = [InMonoClass](MonoClass* InParentMonoClass)
+	{
+		return InParentMonoClass != nullptr &&
+			!!FMonoDomain::Class_Is_Subclass_Of(InMonoClass, InParentMonoClass, false);
+	};
+
+	// Checked in the same order as the field types were matched before
+	auto FieldKind = EFieldKind::None;
+
+	if (IsSubclassOf(Classes.SubclassOf))
+	{
+		FieldKind = EFieldKind::Generic;
+	}
+	else if (Classes.Object != nullptr && (InMonoClass == Classes.Object || IsSubclassOf(Classes.Object)))
+	{
+		if (ClassHasAttr(InMonoClass, Classes.UClassAttribute))
+		{
+			FieldKind = EFieldKind::SoftDependency;
+		}
+	}
+	else if (IsSubclassOf(Classes.ScriptInterface))
+	{
+		FieldKind = EFieldKind::Generic;
+	}
+	else if (IsSubclassOf(Classes.Enum))
+	{
+		if (ClassHasAttr(InMonoClass, Classes.UEnumAttribute))
+		{
+			FieldKind = EFieldKind::Dependency;
+		}
+	}
+	else if (FMonoDomain::Class_Get_Method_From_Name(InMonoClass, FUNCTION_STATIC_STRUCT, 0))
+	{
+		if (ClassHasAttr(InMonoClass, Classes.UStructAttribute))
+		{
+			FieldKind = EFieldKind::Dependency;
+		}
+	}
+	else if (IsSubclassOf(Classes.WeakObjectPtr) ||
+		IsSubclassOf(Classes.LazyObjectPtr) ||
+		IsSubclassOf(Classes.SoftClassPtr) ||
+		IsSubclassOf(Classes.SoftObjectPtr))
+	{
+		FieldKind = EFieldKind::Generic;
+	}
+	else if (IsSubclassOf(Classes.Map))
+	{
+		FieldKind = EFieldKind::GenericPair;
+	}
+	else if (IsSubclassOf(Classes.Set) || IsSubclassOf(Classes.Array))
+	{
+		FieldKind = EFieldKind::Generic;
+	}
+
+	FieldKindMap.Add(InMonoClass, FieldKind);
+
+	return FieldKind;
+}
+
+bool FDynamicGeneratorCore::ClassHasAttr(MonoClass* InMonoClass, MonoClass* InAttributeMonoClass)
+{
+	return InAttributeMonoClass != nullptr &&
+		!!FMonoDomain::Custom_Attrs_Has_Attr(FMonoDomain::Custom_Attrs_From_Class(InMonoClass), InAttributeMonoClass);
+}
+
 void FDynamicGeneratorCore::Generator(const FString& InAttribute, const TFunction<void(MonoClass*)>& InGenerator)
 {
 	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
@@ -721,8 +886,8 @@ void FDynamicGeneratorCore::SetFlags(FProperty* InProperty, MonoCustomAttrInfo*
 			if (const auto FoundProperty = FMonoDomain::Class_Get_Property_From_Name(
 				FMonoDomain::Object_Get_Class(FoundMonoObject), PROPERTY_REP_CALLBACK_NAME))
 			{
-				InProperty->RepNotifyFunc = FName(UTF8_TO_TCHAR(FMonoDomain::String_To_UTF8(
-					(MonoString*)FMonoDomain::Property_Get_Value(FoundProperty, FoundMonoObject, nullptr, nullptr))));
+				InProperty->RepNotifyFunc = FName(FMonoDomain::String_To_FString(
+					(MonoString*)FMonoDomain::Property_Get_Value(FoundProperty, FoundMonoObject, nullptr, nullptr)));
 			}
 		}
 	}
@@ -1052,9 +1217,9 @@ void FDynamicGeneratorCore::SetFlags(UClass* InClass, MonoCustomAttrInfo* InMono
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC),
-		InClass->IsChildOf(UInterface::StaticClass()) ? CLASS_U_INTERFACE_ATTRIBUTE : CLASS_U_CLASS_ATTRIBUTE);
+	const auto AttributeMonoClass = InClass->IsChildOf(UInterface::StaticClass())
+		                                ? GetWellKnownClasses().UInterfaceAttribute
+		                                : GetWellKnownClasses().UClassAttribute;
 
 	if (!!FMonoDomain::Custom_Attrs_Has_Attr(InMonoCustomAttrInfo, AttributeMonoClass))
 	{
@@ -1078,8 +1243,7 @@ void FDynamicGeneratorCore::SetFlags(UScriptStruct* InScriptStruct, MonoCustomAt
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_STRUCT_ATTRIBUTE);
+	const auto AttributeMonoClass = GetWellKnownClasses().UStructAttribute;
 
 	if (!!FMonoDomain::Custom_Attrs_Has_Attr(InMonoCustomAttrInfo, AttributeMonoClass))
 	{
@@ -1096,8 +1260,7 @@ void FDynamicGeneratorCore::SetFlags(UEnum* InEnum, MonoCustomAttrInfo* InMonoCu
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_ENUM_ATTRIBUTE);
+	const auto AttributeMonoClass = GetWellKnownClasses().UEnumAttribute;
 
 	if (!!FMonoDomain::Custom_Attrs_Has_Attr(InMonoCustomAttrInfo, AttributeMonoClass))
 	{
@@ -1217,8 +1380,7 @@ void FDynamicGeneratorCore::SetMetaData(UEnum* InEnum, MonoCustomAttrInfo* InMon
 
 bool FDynamicGeneratorCore::AttrsHasAttr(MonoCustomAttrInfo* InMonoCustomAttrInfo, const FString& InAttributeName)
 {
-	if (const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), InAttributeName))
+	if (const auto AttributeMonoClass = GetAttributeClass(InAttributeName))
 	{
 		return !!FMonoDomain::Custom_Attrs_Has_Attr(InMonoCustomAttrInfo, AttributeMonoClass);
 	}
@@ -1229,8 +1391,7 @@ bool FDynamicGeneratorCore::AttrsHasAttr(MonoCustomAttrInfo* InMonoCustomAttrInf
 MonoObject* FDynamicGeneratorCore::AttrsGetAttr(MonoCustomAttrInfo* InMonoCustomAttrInfo,
                                                 const FString& InAttributeName)
 {
-	if (const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), InAttributeName))
+	if (const auto AttributeMonoClass = GetAttributeClass(InAttributeName))
 	{
 		return FMonoDomain::Custom_Attrs_Get_Attr(InMonoCustomAttrInfo, AttributeMonoClass);
 	}
@@ -1240,8 +1401,7 @@ MonoObject* FDynamicGeneratorCore::AttrsGetAttr(MonoCustomAttrInfo* InMonoCustom
 
 FString FDynamicGeneratorCore::AttrGetValue(MonoCustomAttrInfo* InMonoCustomAttrInfo, const FString& InAttributeName)
 {
-	const auto FoundMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), InAttributeName);
+	const auto FoundMonoClass = GetAttributeClass(InAttributeName);
 
 	const auto FoundMonoObject = FMonoDomain::Custom_Attrs_Get_Attr(InMonoCustomAttrInfo, FoundMonoClass);
 
@@ -1249,7 +1409,7 @@ FString FDynamicGeneratorCore::AttrGetValue(MonoCustomAttrInfo* InMonoCustomAttr
 
 	const auto Value = FMonoDomain::Property_Get_Value(FoundMonoProperty, FoundMonoObject, nullptr, nullptr);
 
-	return FString(UTF8_TO_TCHAR(FMonoDomain::String_To_UTF8(FMonoDomain::Object_To_String(Value,nullptr))));
+	return FMonoDomain::String_To_FString(FMonoDomain::Object_To_String(Value, nullptr));
 }
 
 void FDynamicGeneratorCore::GeneratorProperty(MonoClass* InMonoClass, UField* InField,
@@ -1260,145 +1420,85 @@ void FDynamicGeneratorCore::GeneratorProperty(MonoClass* InMonoClass, UField* In
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_PROPERTY_ATTRIBUTE);
-
-	void* Iterator = nullptr;
+	const auto& ClassDescriptor = FindOrAddClassDescriptor(InMonoClass);
 
-	while (const auto Property = FMonoDomain::Class_Get_Properties(InMonoClass, &Iterator))
+	for (const auto& [Attrs, Name, ReflectionType] : ClassDescriptor.PropertyDescriptors)
 	{
-		if (const auto Attrs = FMonoDomain::Custom_Attrs_From_Property(InMonoClass, Property))
-		{
-			if (!!FMonoDomain::Custom_Attrs_Has_Attr(Attrs, AttributeMonoClass))
-			{
-				const auto PropertyName = FMonoDomain::Property_Get_Name(Property);
+		const auto CppProperty = FTypeBridge::Factory<true>(ReflectionType, InField, Name, EObjectFlags::RF_Public);
 
-				const auto PropertyType = FMonoDomain::Property_Get_Type(Property);
-
-				const auto ReflectionType = FMonoDomain::Type_Get_Object(PropertyType);
+		SetFlags(CppProperty, Attrs);
 
-				const auto CppProperty = FTypeBridge::Factory<true>(ReflectionType, InField, PropertyName,
-				                                                    EObjectFlags::RF_Public);
+		InField->AddCppProperty(CppProperty);
 
-				SetFlags(CppProperty, Attrs);
-
-				InField->AddCppProperty(CppProperty);
-
-				InGenerator(CppProperty);
-			}
-		}
+		InGenerator(CppProperty);
 	}
 }
 
 void FDynamicGeneratorCore::GeneratorFunction(MonoClass* InMonoClass, UClass* InClass,
                                               const TFunction<void(const UFunction* InFunction)>& InGenerator)
 {
-	struct FParamDescriptor
-	{
-		MonoReflectionType* ReflectionType;
-
-		FName Name;
-
-		bool bIsRef;
-	};
-
 	if (InMonoClass == nullptr || InClass == nullptr)
 	{
 		return;
 	}
 
-	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
-		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), CLASS_U_FUNCTION_ATTRIBUTE);
-
-	void* MethodIterator = nullptr;
+	const auto& ClassDescriptor = FindOrAddClassDescriptor(InMonoClass);
 
-	while (const auto Method = FMonoDomain::Class_Get_Methods(InMonoClass, &MethodIterator))
+	for (const auto& [Attrs, MethodName, bIsStatic, ReturnReflectionType, ParamDescriptors] :
+	     ClassDescriptor.FunctionDescriptors)
 	{
-		if (const auto Attrs = FMonoDomain::Custom_Attrs_From_Method(Method))
-		{
-			if (!!FMonoDomain::Custom_Attrs_Has_Attr(Attrs, AttributeMonoClass))
-			{
-				const auto MethodName = FMonoDomain::Method_Get_Name(Method);
+		auto Function = NewObject<UFunction>(InClass, MethodName, RF_Public | RF_Transient);
 
-				const auto Signature = FMonoDomain::Method_Signature(Method);
-
-				void* ParamIterator = nullptr;
-
-				const auto ParamCount = FMonoDomain::Signature_Get_Param_Count(Signature);
-
-				const auto ParamNames = static_cast<const char**>(FMemory_Alloca(ParamCount * sizeof(const char*)));
-
-				FMonoDomain::Method_Get_Param_Names(Method, ParamNames);
-
-				auto ParamIndex = 0;
-
-				TArray<FParamDescriptor> ParamDescriptors;
-
-				while (const auto Param = FMonoDomain::Signature_Get_Params(Signature, &ParamIterator))
-				{
-					ParamDescriptors.Add({
-						FMonoDomain::Type_Get_Object(Param),
-						ParamNames[ParamIndex++],
-						!!FMonoDomain::Type_Is_ByRef(Param)
-					});
-				}
-
-				auto Function = NewObject<UFunction>(InClass, MethodName, RF_Public | RF_Transient);
-
-				if (!!!FMonoDomain::Signature_Is_Instance(Signature))
-				{
-					Function->FunctionFlags |= FUNC_Static;
-				}
-
-				Function->MinAlignment = 1;
+		if (bIsStatic)
+		{
+			Function->FunctionFlags |= FUNC_Static;
+		}
 
-				if (const auto ReturnParamType = FMonoDomain::Signature_Get_Return_Type(Signature))
-				{
-					const auto ReturnParamReflectionType = FMonoDomain::Type_Get_Object(ReturnParamType);
+		Function->MinAlignment = 1;
 
-					if (const auto Property = FTypeBridge::Factory<true>(ReturnParamReflectionType, Function, "",
-					                                                     RF_Public | RF_Transient))
-					{
-						Property->SetPropertyFlags(CPF_Parm | CPF_OutParm | CPF_ReturnParm);
+		if (ReturnReflectionType != nullptr)
+		{
+			if (const auto Property = FTypeBridge::Factory<true>(ReturnReflectionType, Function, "",
+			                                                     RF_Public | RF_Transient))
+			{
+				Property->SetPropertyFlags(CPF_Parm | CPF_OutParm | CPF_ReturnParm);
 
-						Function->AddCppProperty(Property);
+				Function->AddCppProperty(Property);
 
-						Function->FunctionFlags |= FUNC_HasOutParms;
-					}
-				}
+				Function->FunctionFlags |= FUNC_HasOutParms;
+			}
+		}
 
-				for (auto Index = ParamDescriptors.Num() - 1; Index >= 0; --Index)
-				{
-					const auto Property = FTypeBridge::Factory<true>(ParamDescriptors[Index].ReflectionType,
-					                                                 Function,
-					                                                 ParamDescriptors[Index].Name,
-					                                                 RF_Public | RF_Transient);
+		for (auto Index = ParamDescriptors.Num() - 1; Index >= 0; --Index)
+		{
+			const auto Property = FTypeBridge::Factory<true>(ParamDescriptors[Index].ReflectionType,
+			                                                 Function,
+			                                                 ParamDescriptors[Index].Name,
+			                                                 RF_Public | RF_Transient);
 
-					Property->SetPropertyFlags(CPF_Parm);
+			Property->SetPropertyFlags(CPF_Parm);
 
-					if (ParamDescriptors[Index].bIsRef)
-					{
-						Property->SetPropertyFlags(CPF_OutParm | CPF_ReferenceParm);
-					}
+			if (ParamDescriptors[Index].bIsRef)
+			{
+				Property->SetPropertyFlags(CPF_OutParm | CPF_ReferenceParm);
+			}
 
-					Function->AddCppProperty(Property);
-				}
+			Function->AddCppProperty(Property);
+		}
 
-				Function->Bind();
+		Function->Bind();
 
-				Function->StaticLink(true);
+		Function->StaticLink(true);
 
-				Function->Next = InClass->Children;
+		Function->Next = InClass->Children;
 
-				InClass->Children = Function;
+		InClass->Children = Function;
 
-				SetFlags(Function, Attrs);
+		SetFlags(Function, Attrs);
 
-				InClass->AddFunctionToFunctionMap(Function, MethodName);
+		InClass->AddFunctionToFunctionMap(Function, MethodName);
 
-				InGenerator(Function);
-			}
-		}
+		InGenerator(Function);
 	}
 }
 
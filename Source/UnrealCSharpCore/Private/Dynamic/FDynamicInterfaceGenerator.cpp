@@ -33,10 +33,19 @@ void FDynamicInterfaceGenerator::Generator()
 
 		                                 const auto ClassName = FString(FMonoDomain::Class_Get_Name(InMonoClass));
 
-		                                 auto Node = FDynamicDependencyGraph::FNode(ClassName, [InMonoClass]()
-		                                 {
-			                                 Generator(InMonoClass);
-		                                 });
+		                                 // Class lookups are cached and not thread safe, so they stay out of Prepare
+		                                 const auto InterfaceMonoClass = FDynamicGeneratorCore::UInterfaceToIInterface(
+			                                 InMonoClass);
+
+		                                 auto Node = FDynamicDependencyGraph::FNode(
+			                                 ClassName, [InterfaceMonoClass]()
+			                                 {
+				                                 FDynamicGeneratorCore::Prepare(InterfaceMonoClass);
+			                                 },
+			                                 [InMonoClass]()
+			                                 {
+				                                 Generator(InMonoClass);
+			                                 });
 
 		                                 if (const auto ParentMonoClass = FMonoDomain::Class_Get_Parent(InMonoClass))
 		                                 {
@@ -30,10 +30,15 @@ void FDynamicStructGenerator::Generator()
 
 		                                 const auto ClassName = FString(FMonoDomain::Class_Get_Name(InMonoClass));
 
-		                                 auto Node = FDynamicDependencyGraph::FNode(ClassName, [InMonoClass]()
-		                                 {
-			                                 Generator(InMonoClass);
-		                                 });
+		                                 auto Node = FDynamicDependencyGraph::FNode(
+			                                 ClassName, [InMonoClass]()
+			                                 {
+				                                 FDynamicGeneratorCore::Prepare(InMonoClass);
+			                                 },
+			                                 [InMonoClass]()
+			                                 {
+				                                 Generator(InMonoClass);
+			                                 });
 
 		                                 if (const auto ParentMonoClass = FMonoDomain::Class_Get_Parent(InMonoClass))
 		                                 {
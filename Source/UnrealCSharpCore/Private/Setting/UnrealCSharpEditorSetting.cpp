@@ -25,12 +25,15 @@ UUnrealCSharpEditorSetting::UUnrealCSharpEditorSetting(const FObjectInitializer&
 	bEnableDeleteProxyDirectory(false),
 	bEnableCompiled(true),
 	bEnableAssetChanged(true),
+	AssetChangedDelay(0.5f),
 	bEnableDirectoryChanged(true),
 	bIsSkipGenerateEngineModules(false),
 	bIsGenerateAllModules(true),
 	bIsGenerateAsset(true),
 	bIsGenerateFunctionComment(true),
-	bEnableExport(false)
+	bEnableExport(false),
+	bEnableAotCompile(false),
+	bEnableAotLLVM(false)
 #else
 	Super(ObjectInitializer)
 #endif
@@ -273,6 +276,11 @@ bool UUnrealCSharpEditorSetting::EnableAssetChanged() const
 	return bEnableAssetChanged;
 }
 
+float UUnrealCSharpEditorSetting::GetAssetChangedDelay() const
+{
+	return AssetChangedDelay;
+}
+
 bool UUnrealCSharpEditorSetting::EnableDirectoryChanged() const
 {
 	return bEnableDirectoryChanged;
@@ -313,6 +321,21 @@ bool UUnrealCSharpEditorSetting::IsGenerateFunctionComment() const
 	return bIsGenerateFunctionComment;
 }
 
+bool UUnrealCSharpEditorSetting::EnableAotCompile() const
+{
+	return bEnableAotCompile;
+}
+
+const FFilePath& UUnrealCSharpEditorSetting::GetAotCompilerPath() const
+{
+	return AotCompilerPath;
+}
+
+bool UUnrealCSharpEditorSetting::EnableAotLLVM() const
+{
+	return bEnableAotLLVM;
+}
+
 TArray<FString> UUnrealCSharpEditorSetting::GetModuleList()
 {
 	TArray<FString> ModuleArray;
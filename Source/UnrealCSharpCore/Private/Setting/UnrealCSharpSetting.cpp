@@ -15,9 +15,12 @@ UUnrealCSharpSetting::UUnrealCSharpSetting(const FObjectInitializer& ObjectIniti
 	  OverrideFunctionNamePrefix(DEFAULT_OVERRIDE_FUNCTION_NAME_PREFIX),
 	  OverrideFunctionNameSuffix(DEFAULT_OVERRIDE_FUNCTION_NAME_SUFFIX),
 	  AssemblyLoader(UAssemblyLoader::StaticClass()),
+	  AotMode(EMonoAotMode::None),
 	  bEnableDebug(false),
 	  Port(0),
-	  bEnableImmediatelyActive(true)
+	  bEnableImmediatelyActive(true),
+	  ReleaseTimeBudget(0.f),
+	  AsyncLoadingBindTimeBudget(0.f)
 {
 }
 
@@ -116,4 +119,19 @@ bool UUnrealCSharpSetting::IsEnableImmediatelyActive() const
 	return bEnableImmediatelyActive;
 }
 
+float UUnrealCSharpSetting::GetReleaseTimeBudget() const
+{
+	return ReleaseTimeBudget;
+}
+
+float UUnrealCSharpSetting::GetAsyncLoadingBindTimeBudget() const
+{
+	return AsyncLoadingBindTimeBudget;
+}
+
+EMonoAotMode UUnrealCSharpSetting::GetAotMode() const
+{
+	return AotMode;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Template/TIsTEnumAsByte.inl"
+#include "Template/TIsBlittableStruct.inl"
 
 template <typename T>
 struct TIsPrimitive
@@ -20,6 +21,7 @@ struct TIsPrimitive
 		std::is_same_v<std::decay_t<T>, double> ||
 		TIsEnum<std::decay_t<T>>::Value ||
 		TIsEnumClass<std::decay_t<T>>::Value ||
-		TIsTEnumAsByte<std::decay_t<T>>::Value
+		TIsTEnumAsByte<std::decay_t<T>>::Value ||
+		TIsBlittableStruct<std::decay_t<T>>::Value
 	};
 };
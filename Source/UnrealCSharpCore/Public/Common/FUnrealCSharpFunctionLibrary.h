@@ -153,6 +153,8 @@ public:
 
 	static bool IsGameField(const UField* InField);
 
+	static bool IsBlittableStruct(const UScriptStruct* InScriptStruct);
+
 #if WITH_EDITOR
 	static FString GetGenerationPath(const UField* InField);
 
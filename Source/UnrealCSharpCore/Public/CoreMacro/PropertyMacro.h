@@ -2,6 +2,8 @@
 
 #define PROPERTY_GARBAGE_COLLECTION_HANDLE FString(TEXT("GarbageCollectionHandle"))
 
+#define PROPERTY_GARBAGE_COLLECTION_HANDLE_BACKING_FIELD "<GarbageCollectionHandle>k__BackingField"
+
 #define PROPERTY_METHOD FString(TEXT("Method"))
 
 #define PROPERTY_STATIC_CLASS_SINGLETON FString(TEXT("StaticClassSingleton"))
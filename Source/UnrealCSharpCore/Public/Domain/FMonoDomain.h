@@ -64,6 +64,8 @@ public:
 
 	static MonoType* Field_Get_Type(MonoClassField* InMonoClassField);
 
+	static uint32 Field_Get_Offset(MonoClassField* InMonoClassField);
+
 	static MonoObject* Field_Get_Value_Object(MonoDomain* InMonoDomain, MonoClassField* InMonoClassField,
 	                                          MonoObject* InMonoObject);
 
@@ -103,6 +105,8 @@ public:
 
 	static mono_bool Type_Is_ByRef(MonoType* InMonoType);
 
+	static mono_bool Type_Is_Reference(MonoType* InMonoType);
+
 	static MonoReflectionMethod* Method_Get_Object(MonoMethod* InMethod, MonoClass* InMonoClass);
 
 	static MonoObject* Runtime_Invoke(MonoMethod* InFunction, void* InMonoObject, void** InParams);
@@ -132,6 +136,12 @@ public:
 
 	static char* String_To_UTF8(MonoString* InMonoString);
 
+	static MonoString* String_New_UTF16(const mono_unichar2* InText, int32 InLength);
+
+	static mono_unichar2* String_Chars(MonoString* InMonoString);
+
+	static int32 String_Length(MonoString* InMonoString);
+
 	static MonoArray* Array_New(MonoClass* InMonoClass, uint32 InNum);
 
 	static uint64 Array_Length(MonoArray* InMonoArray);
@@ -178,8 +188,14 @@ public:
 
 	static void GCHandle_Free_V2(MonoGCHandle InGCHandle);
 
+	static int64 GC_Get_Allocated_Bytes_For_Current_Thread();
+
 	static void* Method_Get_Unmanaged_Thunk(MonoMethod* InMonoMethod);
 
+	static MonoThread* Thread_Attach();
+
+	static void Thread_Detach(MonoThread* InMonoThread);
+
 public:
 	static void Class_Constructor(MonoClass* InMonoClass);
 
@@ -190,6 +206,11 @@ public:
 
 	static MonoClassField* Self_Class_Get_Field_From_Name(MonoClass* InMonoClass, const char* InName);
 
+	static uint32 Class_Get_Garbage_Collection_Handle_Offset(MonoClass* InMonoClass);
+
+	// Changes whenever the assemblies are unloaded, classes resolved under another generation are invalid
+	static uint32 Get_Class_Generation();
+
 	static MonoType* Property_Get_Type(MonoProperty* InMonoProperty);
 
 	static MonoMethod* Class_Get_Method_From_Params(MonoClass* InMonoClass, const FString& InMethodName,
@@ -201,6 +222,10 @@ public:
 
 	static mono_bool Type_Is_Enum(MonoType* InMonoType);
 
+	static MonoString* String_New(const TCHAR* InText, int32 InLength);
+
+	static FString String_To_FString(MonoString* InMonoString);
+
 public:
 	static MonoAssembly* AssemblyPreloadHook(MonoAssemblyName* InAssemblyName, char** OutAssemblyPath,
 	                                         void* InUserData);
@@ -232,6 +257,8 @@ private:
 
 	static void RegisterBinding();
 
+	static void ResetCache();
+
 public:
 	static MonoDomain* Domain;
 
@@ -244,4 +271,15 @@ public:
 	static TArray<MonoImage*> Images;
 
 	static bool bLoadSucceed;
+
+private:
+	// The names are hashed case-sensitively into the key, so a lookup does not build a key out of strings
+	static TMap<uint64, MonoClass*> ClassCache;
+
+	static TMap<TTuple<MonoClass*, uint64, int32>, MonoMethod*> MethodCache;
+
+	static TMap<MonoClass*, uint32> GarbageCollectionHandleOffsetCache;
+
+	// The caches are also reached from worker threads, such as the parallel generators
+	static FCriticalSection CacheCriticalSection;
 };
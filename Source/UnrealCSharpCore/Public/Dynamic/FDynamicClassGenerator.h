@@ -37,7 +37,21 @@ public:
 
 	static UNREALCSHARPCORE_API UClass* GetDynamicClass(MonoClass* InMonoClass);
 
+	static UNREALCSHARPCORE_API void UpdateClassConstructor(const UClass* InClass);
+
 private:
+	struct FClassConstructorPlan
+	{
+		// Offset and size of the zero constructed properties, adjacent ones are merged
+		TArray<TPair<int32, int32>> ZeroInitializeRanges;
+
+		TArray<FProperty*> InitializeProperties;
+
+		UClass* ConstructorClass = nullptr;
+
+		UClass::ClassConstructorType ClassConstructor = nullptr;
+	};
+
 	static void BeginGenerator(UClass* InClass, UClass* InParentClass);
 
 	static void BeginGenerator(UBlueprintGeneratedClass* InClass, UClass* InParentClass);
@@ -83,6 +97,10 @@ private:
 
 	static void GeneratorInterface(MonoClass* InMonoClass, UClass* InClass);
 
+	static void GeneratorClassConstructorPlan(UClass* InClass);
+
+	static void ResolveClassConstructor(UClass* InClass, FClassConstructorPlan& OutClassConstructorPlan);
+
 	static void ClassConstructor(const FObjectInitializer& InObjectInitializer);
 
 	static bool IsDynamicBlueprintGeneratedClass(const FString& InName);
@@ -94,4 +112,6 @@ private:
 	static TMap<FString, UClass*> DynamicClassMap;
 
 	static TSet<UClass*> DynamicClassSet;
+
+	static TMap<UClass*, FClassConstructorPlan> ClassConstructorPlanMap;
 };
@@ -26,6 +26,15 @@ public:
 		{
 		}
 
+		FNode(const FString& InName, const TFunction<void()>& InPrepareImplementation,
+		      const TFunction<void()>& InGeneratorImplementation):
+			Name(InName),
+			State(EState::Initial),
+			PrepareImplementation(InPrepareImplementation),
+			GeneratorImplementation(InGeneratorImplementation)
+		{
+		}
+
 		bool IsInitial() const
 		{
 			return State == EState::Initial;
@@ -56,6 +65,14 @@ public:
 			Dependencies.Add(InDependency);
 		}
 
+		void Prepare() const
+		{
+			if (PrepareImplementation)
+			{
+				PrepareImplementation();
+			}
+		}
+
 		void Generator()
 		{
 			GeneratorImplementation();
@@ -72,6 +89,10 @@ public:
 
 		TArray<FDependency> Dependencies;
 
+		// Only reads reflection data, the nodes of a level are prepared in parallel
+		TFunction<void()> PrepareImplementation;
+
+		// Creates the UObjects, always runs on the calling thread
 		TFunction<void()> GeneratorImplementation;
 
 		TArray<TFunction<void()>> OnCompleted;
@@ -92,5 +113,15 @@ public:
 	void Generator();
 
 private:
-	TSortedMap<FString, FNode> Nodes;
+	FNode* FindNode(const FString& InName);
+
+	void AddNodeAlias(const FString& InName, int32 InIndex);
+
+private:
+	TArray<FNode> Nodes;
+
+	TMap<FString, int32> NodeIndices;
+
+	// Soft references name a type without its A, U or F prefix, every node is reachable through that name as well
+	TMap<FString, int32> NodeAliases;
 };
@@ -18,6 +18,10 @@ public:
 	static const FString& DynamicReInstanceBaseName();
 #endif
 
+	static void BeginGenerator();
+
+	static void EndGenerator();
+
 	static void AddNode(const FDynamicDependencyGraph::FNode& InNode);
 
 	static bool IsCompleted(const FString& InName);
@@ -36,6 +40,8 @@ public:
 
 	static void GeneratorInterface(MonoClass* InMonoClass, FDynamicDependencyGraph::FNode& OutNode);
 
+	static void Prepare(MonoClass* InMonoClass);
+
 	static bool ClassHasAttr(MonoClass* InMonoClass, const FString& InAttributeName);
 
 	static void Generator(const FString& InAttribute, const TFunction<void(MonoClass*)>& InGenerator);
@@ -101,6 +107,119 @@ public:
 	static MonoClass* IInterfaceToUInterface(MonoClass* InMonoClass);
 
 private:
+	enum class EFieldKind : uint8
+	{
+		None,
+		Generic,
+		GenericPair,
+		SoftDependency,
+		Dependency
+	};
+
+	struct FWellKnownClasses
+	{
+		bool bIsInitialized = false;
+
+		MonoClass* SubclassOf = nullptr;
+
+		MonoClass* Object = nullptr;
+
+		MonoClass* ScriptInterface = nullptr;
+
+		MonoClass* Enum = nullptr;
+
+		MonoClass* WeakObjectPtr = nullptr;
+
+		MonoClass* LazyObjectPtr = nullptr;
+
+		MonoClass* SoftClassPtr = nullptr;
+
+		MonoClass* SoftObjectPtr = nullptr;
+
+		MonoClass* Map = nullptr;
+
+		MonoClass* Set = nullptr;
+
+		MonoClass* Array = nullptr;
+
+		MonoClass* UClassAttribute = nullptr;
+
+		MonoClass* UStructAttribute = nullptr;
+
+		MonoClass* UEnumAttribute = nullptr;
+
+		MonoClass* UInterfaceAttribute = nullptr;
+
+		MonoClass* UPropertyAttribute = nullptr;
+
+		MonoClass* UFunctionAttribute = nullptr;
+
+		// Flag and meta data attributes, resolved on first use
+		TMap<FString, MonoClass*> Attributes;
+	};
+
+	struct FPropertyDescriptor
+	{
+		MonoCustomAttrInfo* Attrs;
+
+		const char* Name;
+
+		MonoReflectionType* ReflectionType;
+	};
+
+	struct FParamDescriptor
+	{
+		MonoReflectionType* ReflectionType;
+
+		FName Name;
+
+		bool bIsRef;
+	};
+
+	struct FFunctionDescriptor
+	{
+		MonoCustomAttrInfo* Attrs;
+
+		const char* Name;
+
+		bool bIsStatic;
+
+		MonoReflectionType* ReturnReflectionType;
+
+		TArray<FParamDescriptor> ParamDescriptors;
+	};
+
+	struct FClassDescriptor
+	{
+		TArray<FPropertyDescriptor> PropertyDescriptors;
+
+		TArray<FFunctionDescriptor> FunctionDescriptors;
+	};
+
+	static const FWellKnownClasses& GetWellKnownClasses();
+
+	static MonoClass* GetAttributeClass(const FString& InAttributeName);
+
+	static FClassDescriptor GetClassDescriptor(MonoClass* InMonoClass);
+
+	static const FClassDescriptor& FindOrAddClassDescriptor(MonoClass* InMonoClass);
+
+	static EFieldKind GetFieldKind(MonoClass* InMonoClass);
+
+	static bool ClassHasAttr(MonoClass* InMonoClass, MonoClass* InAttributeMonoClass);
+
+private:
+	// Resolved once per domain load, the classes are invalid after the assemblies are unloaded
+	static FWellKnownClasses WellKnownClasses;
+
+	static TMap<MonoClass*, EFieldKind> FieldKindMap;
+
+	// Filled by Prepare from worker threads, read by the generators once the level is prepared,
+	// held by pointer so that references handed out stay valid while other threads add to the map
+	static TMap<MonoClass*, TUniquePtr<FClassDescriptor>> ClassDescriptorMap;
+
+	static FCriticalSection ClassDescriptorCriticalSection;
+
 #if WITH_EDITOR
 	static TMap<FString, TArray<FString>> DynamicMap;
 
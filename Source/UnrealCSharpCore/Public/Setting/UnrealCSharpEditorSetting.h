@@ -52,6 +52,8 @@ public:
 
 	bool EnableAssetChanged() const;
 
+	float GetAssetChangedDelay() const;
+
 	bool EnableDirectoryChanged() const;
 
 	bool IsSkipGenerateEngineModules() const;
@@ -68,6 +70,12 @@ public:
 
 	bool IsGenerateFunctionComment() const;
 
+	bool EnableAotCompile() const;
+
+	const FFilePath& GetAotCompilerPath() const;
+
+	bool EnableAotLLVM() const;
+
 	UFUNCTION()
 	TArray<FString> GetModuleList();
 #endif
@@ -89,6 +97,11 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = Generator)
 	bool bEnableAssetChanged;
 
+	// Asset changes are collected until none arrived for this long, then generated and compiled once
+	UPROPERTY(Config, EditAnywhere, Category = Generator,
+		meta = (EditCondition = "bEnableAssetChanged", ClampMin = "0.0", Units = "s"))
+	float AssetChangedDelay;
+
 	UPROPERTY(Config, EditAnywhere, Category = Generator)
 	bool bEnableDirectoryChanged;
 
@@ -121,5 +134,16 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = Generator,
 		meta = (GetOptions = "GetModuleList", EditCondition = "bEnableExport"))
 	TArray<FString> ExportModule;
+
+	// Precompiles the published assemblies for Linux after the cook compiles them, see AOT Mode
+	UPROPERTY(Config, EditAnywhere, Category = AOT, meta = (DisplayName = "Enable AOT Compile"))
+	bool bEnableAotCompile;
+
+	// Mono AOT cross compiler targeting linux-x64
+	UPROPERTY(Config, EditAnywhere, Category = AOT, meta = (EditCondition = "bEnableAotCompile"))
+	FFilePath AotCompilerPath;
+
+	UPROPERTY(Config, EditAnywhere, Category = AOT, meta = (EditCondition = "bEnableAotCompile"))
+	bool bEnableAotLLVM;
 #endif
 };
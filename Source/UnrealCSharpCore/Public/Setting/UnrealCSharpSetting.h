@@ -62,6 +62,17 @@ struct FBindClass
 	bool bNeedMonoClass = true;
 };
 
+UENUM()
+enum class EMonoAotMode : uint8
+{
+	// Every method is compiled by the JIT on first call
+	None,
+	// Precompiled images are used when present, everything else is compiled by the JIT
+	Normal,
+	// Precompiled images built with --aot=hybrid, the JIT is still available for what they do not cover
+	Hybrid
+};
+
 /**
  * 
  */
@@ -104,6 +115,12 @@ public:
 
 	bool IsEnableImmediatelyActive() const;
 
+	float GetReleaseTimeBudget() const;
+
+	float GetAsyncLoadingBindTimeBudget() const;
+
+	EMonoAotMode GetAotMode() const;
+
 private:
 	UPROPERTY(Config, EditAnywhere, Category = Publish, meta = (RelativePath))
 	FGameContentDirectoryPath PublishDirectory;
@@ -129,6 +146,10 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = Domain)
 	TSubclassOf<UAssemblyLoader> AssemblyLoader;
 
+	// Only applies to packaged Linux builds, the images are produced by the AOT step of the cook
+	UPROPERTY(Config, EditAnywhere, Category = Domain, meta = (DisplayName = "AOT Mode"))
+	EMonoAotMode AotMode;
+
 	UPROPERTY(Config, EditAnywhere, Category = Bind)
 	TArray<FBindClass> BindClass;
 
@@ -143,4 +164,12 @@ private:
 
 	UPROPERTY(Config, EditAnywhere, Category = Module)
 	bool bEnableImmediatelyActive;
+
+	// Milliseconds per frame spent releasing finalized managed wrappers, 0 means no limit
+	UPROPERTY(Config, EditAnywhere, Category = GarbageCollection, meta = (ClampMin = "0", Units = "ms"))
+	float ReleaseTimeBudget;
+
+	// Milliseconds per frame spent binding async loaded objects, the rest is deferred, 0 means no limit
+	UPROPERTY(Config, EditAnywhere, Category = Bind, meta = (ClampMin = "0", Units = "ms"))
+	float AsyncLoadingBindTimeBudget;
 };
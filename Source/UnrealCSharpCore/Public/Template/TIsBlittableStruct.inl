@@ -0,0 +1,7 @@
+﻿#pragma once
+
+template <typename T>
+struct TIsBlittableStruct
+{
+	enum { Value = false };
+};
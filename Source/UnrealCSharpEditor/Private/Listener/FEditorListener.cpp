@@ -13,9 +13,12 @@
 #include "Setting/UnrealCSharpEditorSetting.h"
 
 FEditorListener::FEditorListener():
+	LastAssetChangedTime(0.0),
 	bIsPIEPlaying(false),
 	bIsGenerating(false)
 {
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEditorListener::OnTick));
+
 	OnPostEngineInitDelegateHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FEditorListener::OnPostEngineInit);
 
 	OnPreBeginPIEDelegateHandle = FEditorDelegates::PreBeginPIE.AddRaw(this, &FEditorListener::OnPreBeginPIE);
@@ -56,6 +59,8 @@ FEditorListener::FEditorListener():
 
 FEditorListener::~FEditorListener()
 {
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
 	if (OnDirectoryChangedDelegateHandle.IsValid())
 	{
 		auto& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(
@@ -132,46 +137,13 @@ void FEditorListener::OnCancelPIEEnded()
 
 void FEditorListener::OnBeginGenerator()
 {
-	auto& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-
-	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
-		UUnrealCSharpEditorSetting>())
-	{
-		if (UnrealCSharpEditorSetting->EnableDeleteProxyDirectory())
-		{
-			if (const auto UEProxyDirectory = FUnrealCSharpFunctionLibrary::GetUEProxyDirectory();
-				PlatformFile.DirectoryExists(*UEProxyDirectory))
-			{
-				PlatformFile.DeleteDirectoryRecursively(*UEProxyDirectory);
-			}
-
-			if (const auto GameProxyDirectory = FUnrealCSharpFunctionLibrary::GetGameProxyDirectory();
-				PlatformFile.DirectoryExists(*GameProxyDirectory))
-			{
-				PlatformFile.DeleteDirectoryRecursively(*GameProxyDirectory);
-			}
-		}
-	}
-
-	auto BindingPath = FPaths::Combine(FUnrealCSharpFunctionLibrary::GetGameProxyDirectory(),
-	                                   FUnrealCSharpFunctionLibrary::GetBindingDirectory());
-
-	if (PlatformFile.DirectoryExists(*BindingPath))
-	{
-		PlatformFile.DeleteDirectoryRecursively(*BindingPath);
-	}
-
-	BindingPath = FPaths::Combine(FUnrealCSharpFunctionLibrary::GetUEProxyDirectory(),
-	                              FUnrealCSharpFunctionLibrary::GetBindingDirectory());
-
-	if (PlatformFile.DirectoryExists(*BindingPath))
-	{
-		PlatformFile.DeleteDirectoryRecursively(*BindingPath);
-	}
-
 	bIsGenerating = true;
 
 	FileChanges.Reset();
+
+	GenerateAssets.Reset();
+
+	DeleteFiles.Reset();
 }
 
 void FEditorListener::OnEndGenerator()
@@ -194,40 +166,38 @@ void FEditorListener::OnFilesLoaded()
 	AssetRegistryModule.Get().OnAssetUpdated().AddRaw(this, &FEditorListener::OnAssetUpdated);
 }
 
-void FEditorListener::OnAssetAdded(const FAssetData& InAssetData) const
+void FEditorListener::OnAssetAdded(const FAssetData& InAssetData)
 {
-	OnAssetChanged([&]
+	if (CanAssetChanged())
 	{
-		FAssetGenerator::Generator(InAssetData);
-	});
+		AddAssetChanged(InAssetData);
+	}
 }
 
-void FEditorListener::OnAssetRemoved(const FAssetData& InAssetData) const
+void FEditorListener::OnAssetRemoved(const FAssetData& InAssetData)
 {
-	OnAssetChanged([&]
+	if (CanAssetChanged())
 	{
-		FPlatformFileManager::Get().Get().GetPlatformFile().DeleteFile(
-			*FUnrealCSharpFunctionLibrary::GetFileName(InAssetData));
-	});
+		RemoveAssetChanged(FUnrealCSharpFunctionLibrary::GetFileName(InAssetData));
+	}
 }
 
-void FEditorListener::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath) const
+void FEditorListener::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
 {
-	OnAssetChanged([&]
+	if (CanAssetChanged())
 	{
-		FPlatformFileManager::Get().Get().GetPlatformFile().DeleteFile(
-			*FUnrealCSharpFunctionLibrary::GetOldFileName(InAssetData, InOldObjectPath));
+		RemoveAssetChanged(FUnrealCSharpFunctionLibrary::GetOldFileName(InAssetData, InOldObjectPath));
 
-		FAssetGenerator::Generator(InAssetData);
-	});
+		AddAssetChanged(InAssetData);
+	}
 }
 
-void FEditorListener::OnAssetUpdated(const FAssetData& InAssetData) const
+void FEditorListener::OnAssetUpdated(const FAssetData& InAssetData)
 {
-	OnAssetChanged([&]
+	if (CanAssetChanged())
 	{
-		FAssetGenerator::Generator(InAssetData);
-	});
+		AddAssetChanged(InAssetData);
+	}
 }
 
 void FEditorListener::OnMainFrameCreationFinished(const TSharedPtr<SWindow> InRootWindow, bool)
@@ -299,23 +269,84 @@ void FEditorListener::OnDirectoryChanged(const TArray<FFileChangeData>& InFileCh
 	}
 }
 
-void FEditorListener::OnAssetChanged(const TFunction<void()>& InGenerator) const
+bool FEditorListener::CanAssetChanged() const
 {
 	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
 		UUnrealCSharpEditorSetting>())
 	{
-		if (UnrealCSharpEditorSetting->EnableAssetChanged())
-		{
-			if (!bIsPIEPlaying && !bIsGenerating)
-			{
-				FGeneratorCore::BeginGenerator();
+		return UnrealCSharpEditorSetting->EnableAssetChanged() && !bIsPIEPlaying && !bIsGenerating;
+	}
 
-				InGenerator();
+	return false;
+}
 
-				FCSharpCompiler::Get().Compile();
+void FEditorListener::AddAssetChanged(const FAssetData& InAssetData)
+{
+	const auto FileName = FUnrealCSharpFunctionLibrary::GetFileName(InAssetData);
 
-				FGeneratorCore::EndGenerator();
-			}
-		}
+	DeleteFiles.Remove(FileName);
+
+	GenerateAssets.Add(FileName, InAssetData);
+
+	LastAssetChangedTime = FPlatformTime::Seconds();
+}
+
+void FEditorListener::RemoveAssetChanged(const FString& InFileName)
+{
+	GenerateAssets.Remove(InFileName);
+
+	DeleteFiles.Add(InFileName);
+
+	LastAssetChangedTime = FPlatformTime::Seconds();
+}
+
+bool FEditorListener::OnTick(float)
+{
+	if (GenerateAssets.IsEmpty() && DeleteFiles.IsEmpty())
+	{
+		return true;
 	}
+
+	if (bIsPIEPlaying || bIsGenerating)
+	{
+		return true;
+	}
+
+	auto AssetChangedDelay = 0.f;
+
+	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+		UUnrealCSharpEditorSetting>())
+	{
+		AssetChangedDelay = UnrealCSharpEditorSetting->GetAssetChangedDelay();
+	}
+
+	if (FPlatformTime::Seconds() - LastAssetChangedTime < AssetChangedDelay)
+	{
+		return true;
+	}
+
+	// Changes raised while this batch is generated are collected into the next one
+	const auto PendingGenerateAssets = MoveTemp(GenerateAssets);
+
+	const auto PendingDeleteFiles = MoveTemp(DeleteFiles);
+
+	FGeneratorCore::BeginGenerator();
+
+	auto& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	for (const auto& DeleteFile : PendingDeleteFiles)
+	{
+		PlatformFile.DeleteFile(*DeleteFile);
+	}
+
+	for (const auto& [PLACEHOLDER, AssetData] : PendingGenerateAssets)
+	{
+		FAssetGenerator::Generator(AssetData);
+	}
+
+	FCSharpCompiler::Get().Compile();
+
+	FGeneratorCore::EndGenerator();
+
+	return true;
 }
@@ -206,9 +206,26 @@ void FUnrealCSharpEditorModule::UpdatePackagingSettings()
 	if (const auto ProjectPackagingSettings = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
 		UProjectPackagingSettings>())
 	{
+		// Precompiled images are loaded by the dynamic linker, so they have to stay loose files
+		bool bIsAotCompile{};
+
+		if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+			UUnrealCSharpEditorSetting>())
+		{
+			bIsAotCompile = UnrealCSharpEditorSetting->EnableAotCompile();
+		}
+
+		auto& StageDirectories = bIsAotCompile
+			                         ? ProjectPackagingSettings->DirectoriesToAlwaysStageAsNonUFS
+			                         : ProjectPackagingSettings->DirectoriesToAlwaysStageAsUFS;
+
+		auto& OtherStageDirectories = bIsAotCompile
+			                              ? ProjectPackagingSettings->DirectoriesToAlwaysStageAsUFS
+			                              : ProjectPackagingSettings->DirectoriesToAlwaysStageAsNonUFS;
+
 		bool bIsExisted{};
 
-		for (const auto& [Path] : ProjectPackagingSettings->DirectoriesToAlwaysStageAsUFS)
+		for (const auto& [Path] : StageDirectories)
 		{
 			if (Path == PublishDirectory)
 			{
@@ -218,10 +235,18 @@ void FUnrealCSharpEditorModule::UpdatePackagingSettings()
 			}
 		}
 
+		const auto RemovedCount = OtherStageDirectories.RemoveAll([&PublishDirectory](const FDirectoryPath& InDirectory)
+		{
+			return InDirectory.Path == PublishDirectory;
+		});
+
 		if (!bIsExisted)
 		{
-			ProjectPackagingSettings->DirectoriesToAlwaysStageAsUFS.Add({PublishDirectory});
+			StageDirectories.Add({PublishDirectory});
+		}
 
+		if (!bIsExisted || RemovedCount > 0)
+		{
 			ProjectPackagingSettings->TryUpdateDefaultConfigFile();
 		}
 	}
@@ -231,6 +256,8 @@ void FUnrealCSharpEditorModule::Generator()
 {
 	FUnrealCSharpCoreModuleDelegates::OnBeginGenerator.Broadcast();
 
+	FGeneratorCore::BeginFileTracking();
+
 	static FString DefaultCultureName = TEXT("en");
 
 	const auto CurrentCultureName = FInternationalization::Get().GetCurrentCulture().Get().GetName();
@@ -289,6 +316,8 @@ void FUnrealCSharpEditorModule::Generator()
 
 	FBindingEnumGenerator::Generator();
 
+	FGeneratorCore::EndFileTracking();
+
 	SlowTask.EnterProgressFrame(1, LOCTEXT("GeneratingCodeAction", "Garbage Collect"));
 
 	CollectGarbage(RF_NoFlags, true);
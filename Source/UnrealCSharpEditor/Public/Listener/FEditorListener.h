@@ -24,13 +24,13 @@ private:
 
 	void OnFilesLoaded();
 
-	void OnAssetAdded(const FAssetData& InAssetData) const;
+	void OnAssetAdded(const FAssetData& InAssetData);
 
-	void OnAssetRemoved(const FAssetData& InAssetData) const;
+	void OnAssetRemoved(const FAssetData& InAssetData);
 
-	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath) const;
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
 
-	void OnAssetUpdated(const FAssetData& InAssetData) const;
+	void OnAssetUpdated(const FAssetData& InAssetData);
 
 	void OnMainFrameCreationFinished(TSharedPtr<SWindow> InRootWindow, bool);
 
@@ -39,7 +39,13 @@ private:
 	void OnDirectoryChanged(const TArray<FFileChangeData>& InFileChanges);
 
 private:
-	void OnAssetChanged(const TFunction<void()>& InGenerator) const;
+	bool CanAssetChanged() const;
+
+	void AddAssetChanged(const FAssetData& InAssetData);
+
+	void RemoveAssetChanged(const FString& InFileName);
+
+	bool OnTick(float InDeltaTime);
 
 private:
 	FDelegateHandle OnPostEngineInitDelegateHandle;
@@ -58,9 +64,18 @@ private:
 
 	FDelegateHandle OnDirectoryChangedDelegateHandle;
 
+	FTSTicker::FDelegateHandle TickHandle;
+
 private:
 	TArray<FFileChangeData> FileChanges;
 
+	// Pending asset changes keyed by the generated file name, so repeated events of an asset collapse into one
+	TMap<FString, FAssetData> GenerateAssets;
+
+	TSet<FString> DeleteFiles;
+
+	double LastAssetChangedTime;
+
 	bool bIsPIEPlaying;
 
 	bool bIsGenerating;